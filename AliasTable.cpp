@@ -0,0 +1,92 @@
+#include "AliasTable.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+constexpr double kScale = 4294967296.0; // 2^32
+constexpr size_t kChunk = 256;
+
+} // namespace
+
+AliasTable::AliasTable(const std::vector<double>& weights) {
+    Build(weights);
+}
+
+void AliasTable::Build(const std::vector<double>& weights) {
+    const size_t n = weights.size();
+    if (n == 0 || n > UINT32_MAX)
+        throw std::invalid_argument("Alias table size out of range");
+
+    double total = 0.0;
+    for (double w : weights) {
+        if (!(w >= 0.0) || std::isinf(w))
+            throw std::invalid_argument("Alias table weights must be finite and non-negative");
+        total += w;
+    }
+    if (total <= 0.0)
+        throw std::invalid_argument("Alias table weights sum to zero");
+
+    // Нормируем так, чтобы средняя вероятность столбца была равна 1
+    std::vector<double> prob(n);
+    for (size_t i = 0; i < n; ++i) {
+        prob[i] = weights[i] * static_cast<double>(n) / total;
+    }
+
+    threshold_.assign(n, 0);
+    alias_.resize(n);
+    std::vector<uint32_t> small, large;
+    small.reserve(n);
+    large.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        (prob[i] < 1.0 ? small : large).push_back(static_cast<uint32_t>(i));
+    }
+
+    while (!small.empty() && !large.empty()) {
+        const uint32_t s = small.back();
+        small.pop_back();
+        const uint32_t l = large.back();
+
+        threshold_[s] = static_cast<uint64_t>(prob[s] * kScale);
+        alias_[s] = l;
+
+        prob[l] -= 1.0 - prob[s];
+        if (prob[l] < 1.0) {
+            large.pop_back();
+            small.push_back(l);
+        }
+    }
+    // Оставшиеся столбцы заполнены целиком (погрешность округления)
+    for (uint32_t i : large) {
+        threshold_[i] = static_cast<uint64_t>(kScale);
+        alias_[i] = i;
+    }
+    for (uint32_t i : small) {
+        threshold_[i] = static_cast<uint64_t>(kScale);
+        alias_[i] = i;
+    }
+}
+
+uint32_t AliasTable::Sample(BatchRandom& rng) const {
+    const uint64_t raw = rng.Next();
+    const auto column = static_cast<uint32_t>(rng.NextBounded(alias_.size()));
+    const auto coin = static_cast<uint32_t>(raw);
+    return coin < threshold_[column] ? column : alias_[column];
+}
+
+void AliasTable::Sample(BatchRandom& rng, uint32_t* out, size_t n) const {
+    const auto columns = static_cast<uint32_t>(alias_.size());
+    alignas(32) uint64_t coins[kChunk];
+
+    for (size_t start = 0; start < n; start += kChunk) {
+        const size_t count = std::min(kChunk, n - start);
+        rng.FillBounded(out + start, count, columns);
+        rng.Fill(coins, count);
+        for (size_t i = 0; i < count; ++i) {
+            const uint32_t column = out[start + i];
+            const auto coin = static_cast<uint32_t>(coins[i]);
+            out[start + i] = coin < threshold_[column] ? column : alias_[column];
+        }
+    }
+}
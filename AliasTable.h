@@ -0,0 +1,29 @@
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+#include "BatchRandom.h"
+#include <vector>
+
+// Таблица Уолкера (alias method) для выборки индекса i с вероятностью,
+// пропорциональной weights[i], за O(1). Строится за O(n) методом Воуза.
+// Выборка целочисленная: номер столбца и 32-битная «монетка».
+class AliasTable {
+public:
+    AliasTable() = default;
+    explicit AliasTable(const std::vector<double>& weights);
+
+    void Build(const std::vector<double>& weights);
+
+    [[nodiscard]] size_t Size() const { return alias_.size(); }
+
+    uint32_t Sample(BatchRandom& rng) const;
+    // Заполняет буфер n независимыми выборками
+    void Sample(BatchRandom& rng, uint32_t* out, size_t n) const;
+
+private:
+    // Порог в [0, 2^32]: монетка r < threshold_[i] оставляет i, иначе берётся alias_[i]
+    std::vector<uint64_t> threshold_;
+    std::vector<uint32_t> alias_;
+};
+
+#endif // ALIAS_TABLE_H
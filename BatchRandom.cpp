@@ -0,0 +1,191 @@
+#include "BatchRandom.h"
+#include <algorithm>
+#include <utility>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace {
+
+constexpr size_t kChunk = 256;
+
+// Финализатор splitmix64
+uint64_t Mix64(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+uint64_t SplitMix64(uint64_t& state) {
+    return Mix64(state += 0x9E3779B97F4A7C15ull);
+}
+
+inline uint64_t Rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// Старшие 64 бита произведения 64x64 -> 128
+inline uint64_t MulHi64(uint64_t a, uint64_t b, uint64_t& lo) {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 m = static_cast<unsigned __int128>(a) * b;
+    lo = static_cast<uint64_t>(m);
+    return static_cast<uint64_t>(m >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t hi;
+    lo = _umul128(a, b, &hi);
+    return hi;
+#else
+    const uint64_t aLo = a & 0xFFFFFFFF, aHi = a >> 32;
+    const uint64_t bLo = b & 0xFFFFFFFF, bHi = b >> 32;
+    const uint64_t ll = aLo * bLo, lh = aLo * bHi, hl = aHi * bLo, hh = aHi * bHi;
+    const uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+    lo = (mid << 32) | (ll & 0xFFFFFFFF);
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+} // namespace
+
+BatchRandom::BatchRandom(uint64_t seed) {
+    // Каждый поток получает собственное состояние из splitmix64, как рекомендуют авторы xoshiro
+    uint64_t state = seed;
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        for (auto& word : s_) {
+            word[lane] = SplitMix64(state);
+        }
+    }
+}
+
+uint64_t BatchRandom::StreamSeed(uint64_t seed, uint64_t stream) {
+    // Перемешивание номера потока разводит состояния соседних потоков
+    return Mix64(seed + Mix64(stream + 1));
+}
+
+void BatchRandom::NextBlock(uint64_t* out) {
+    // Один шаг xoshiro256** для всех потоков; циклы по lane векторизуются
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        out[lane] = Rotl(s_[1][lane] * 5, 7) * 9;
+    }
+    for (size_t lane = 0; lane < kLanes; ++lane) {
+        const uint64_t t = s_[1][lane] << 17;
+        s_[2][lane] ^= s_[0][lane];
+        s_[3][lane] ^= s_[1][lane];
+        s_[1][lane] ^= s_[2][lane];
+        s_[0][lane] ^= s_[3][lane];
+        s_[2][lane] ^= t;
+        s_[3][lane] = Rotl(s_[3][lane], 45);
+    }
+}
+
+uint64_t BatchRandom::Next() {
+    if (bufferPos_ == kLanes) {
+        NextBlock(buffer_);
+        bufferPos_ = 0;
+    }
+    return buffer_[bufferPos_++];
+}
+
+void BatchRandom::Fill(uint64_t* out, size_t n) {
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        NextBlock(out + i);
+    }
+    for (; i < n; ++i) {
+        out[i] = Next();
+    }
+}
+
+uint32_t BatchRandom::NextBounded32(uint32_t range) {
+    uint32_t x = static_cast<uint32_t>(Next() >> 32);
+    uint64_t m = static_cast<uint64_t>(x) * range;
+    auto low = static_cast<uint32_t>(m);
+    if (low < range) {
+        const uint32_t threshold = (0u - range) % range;
+        while (low < threshold) {
+            x = static_cast<uint32_t>(Next() >> 32);
+            m = static_cast<uint64_t>(x) * range;
+            low = static_cast<uint32_t>(m);
+        }
+    }
+    return static_cast<uint32_t>(m >> 32);
+}
+
+uint64_t BatchRandom::NextBounded(uint64_t range) {
+    if (range == 0) {
+        return Next();
+    }
+    if (range <= UINT32_MAX) {
+        return NextBounded32(static_cast<uint32_t>(range));
+    }
+    uint64_t low;
+    uint64_t high = MulHi64(Next(), range, low);
+    if (low < range) {
+        const uint64_t threshold = (0ull - range) % range;
+        while (low < threshold) {
+            high = MulHi64(Next(), range, low);
+        }
+    }
+    return high;
+}
+
+uint64_t BatchRandom::NextInRange(uint64_t min, uint64_t max) {
+    // max - min + 1 переполняется для полного диапазона и даёт 0 - это и есть «весь диапазон»
+    return min + NextBounded(max - min + 1);
+}
+
+void BatchRandom::FillBounded(uint32_t* out, size_t n, uint32_t range) {
+    const uint32_t threshold = (0u - range) % range;
+    alignas(32) uint64_t raw[kChunk / 2];
+    alignas(32) uint32_t raw32[kChunk];
+
+    for (size_t start = 0; start < n; start += kChunk) {
+        const size_t count = std::min(kChunk, n - start);
+        const size_t words = (count + 1) / 2;
+        Fill(raw, words);
+        // Каждое 64-битное число даёт два 32-битных
+        for (size_t k = 0; k < words; ++k) {
+            raw32[2 * k] = static_cast<uint32_t>(raw[k]);
+            raw32[2 * k + 1] = static_cast<uint32_t>(raw[k] >> 32);
+        }
+
+        // Основной проход без ветвлений: отбраковку только отмечаем
+        bool rejected = false;
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t m = static_cast<uint64_t>(raw32[i]) * range;
+            out[start + i] = static_cast<uint32_t>(m >> 32);
+            rejected |= static_cast<uint32_t>(m) < threshold;
+        }
+
+        // Редкий случай: перегенерируем отбракованные значения по одному
+        if (rejected) {
+            for (size_t i = 0; i < count; ++i) {
+                const uint64_t m = static_cast<uint64_t>(raw32[i]) * range;
+                if (static_cast<uint32_t>(m) < threshold) {
+                    out[start + i] = NextBounded32(range);
+                }
+            }
+        }
+    }
+}
+
+void BatchRandom::FillRange(int* out, size_t n, int min, int max) {
+    if (min > max) std::swap(min, max);
+    const uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(max) - min) + 1;
+    alignas(32) uint32_t values[kChunk];
+
+    for (size_t start = 0; start < n; start += kChunk) {
+        const size_t count = std::min(kChunk, n - start);
+        if (span > UINT32_MAX) {
+            // Весь диапазон int: подходят любые 32 бита
+            for (size_t i = 0; i < count; ++i) {
+                values[i] = static_cast<uint32_t>(Next() >> 32);
+            }
+        } else {
+            FillBounded(values, count, static_cast<uint32_t>(span));
+        }
+        for (size_t i = 0; i < count; ++i) {
+            out[start + i] = static_cast<int>(static_cast<int64_t>(min) + values[i]);
+        }
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef BATCH_RANDOM_H
+#define BATCH_RANDOM_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Пакетный генератор случайных чисел: четыре независимых потока xoshiro256**,
+// состояние которых хранится по столбцам (SoA), чтобы компилятор мог векторизовать
+// шаг генератора. Ограниченные числа получаются методом Лемира (умножение и сдвиг
+// вместо деления); деление остаётся только в вычислении порога отбраковки, один раз на буфер.
+// Последовательность полностью определяется seed и одинакова на всех платформах.
+class BatchRandom {
+public:
+    static constexpr size_t kLanes = 4;
+    // Рекомендуемый размер пакета для генераторов графов
+    static constexpr size_t kBlockSize = 1024;
+
+    explicit BatchRandom(uint64_t seed);
+
+    // Seed независимого потока номер stream, производного от общего seed
+    // (для детерминированной генерации по блокам)
+    static uint64_t StreamSeed(uint64_t seed, uint64_t stream);
+
+    // Заполняет буфер равномерными 64-битными числами
+    void Fill(uint64_t* out, size_t n);
+    // Заполняет буфер равномерными числами из [0, range), range > 0
+    void FillBounded(uint32_t* out, size_t n, uint32_t range);
+    // Заполняет буфер равномерными числами из [min, max] включительно
+    void FillRange(int* out, size_t n, int min, int max);
+
+    // Одиночные значения (для параметров генерации)
+    uint64_t Next();
+    // Равномерное число из [0, range); range = 0 означает весь 64-битный диапазон
+    uint64_t NextBounded(uint64_t range);
+    // Равномерное число из [min, max] включительно, min <= max (допускается весь диапазон)
+    uint64_t NextInRange(uint64_t min, uint64_t max);
+
+private:
+    alignas(32) uint64_t s_[4][kLanes];
+    alignas(32) uint64_t buffer_[kLanes];
+    size_t bufferPos_ = kLanes;
+
+    void NextBlock(uint64_t* out);
+    uint32_t NextBounded32(uint32_t range);
+};
+
+#endif // BATCH_RANDOM_H
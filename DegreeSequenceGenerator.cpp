@@ -0,0 +1,194 @@
+#include "DegreeSequenceGenerator.h"
+#include "AliasTable.h"
+#include "BatchRandom.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+constexpr size_t kEdgeBlock = 1 << 16;
+
+// Номера потоков случайных чисел: веса вершин, затем блоки рёбер
+constexpr uint64_t kVertexWeightStream = 0;
+constexpr uint64_t kFirstEdgeStream = 1;
+
+size_t SumDegrees(const std::vector<size_t>& degrees) {
+    if (degrees.size() > UINT32_MAX)
+        throw std::length_error("Vertex count exceeds sampling range");
+    size_t sum = 0;
+    for (size_t d : degrees) sum += d;
+    return sum;
+}
+
+void PrepareGraph(size_t vertexCount, const DegreeGenerationOptions& options, Graph& graph) {
+    graph.SetVertexCount(vertexCount);
+    graph.SetWeighted(options.weighted);
+
+    std::vector<int> weights(vertexCount, 1);
+    if (options.weighted) {
+        BatchRandom rng(BatchRandom::StreamSeed(options.seed, kVertexWeightStream));
+        rng.FillRange(weights.data(), weights.size(), options.minWeight, options.maxWeight);
+    }
+    graph.SetVertexWeights(weights);
+}
+
+void InsertEdges(
+    const std::vector<uint32_t>& from, const std::vector<uint32_t>& to, const std::vector<int>& weights,
+    const DegreeGenerationOptions& options, Graph& graph
+) {
+    size_t selfLoops = 0;
+    size_t multiEdges = 0;
+    for (size_t i = 0; i < from.size(); ++i) {
+        const size_t u = from[i];
+        const size_t v = to[i];
+        const int w = weights.empty() ? 1 : weights[i];
+        if (u == v && options.removeSelfLoops) {
+            selfLoops++;
+            continue;
+        }
+        if (graph.HasEdge(u, v)) {
+            multiEdges++;
+            if (!options.removeMultiEdges) {
+                graph.SetWeight(u, v, graph.GetWeight(u, v) + w);
+            }
+            continue;
+        }
+        graph.AddEdge(u, v, w);
+    }
+    RGG_COUNTER_ADD("degree_generate_self_loops_total", selfLoops);
+    RGG_COUNTER_ADD("degree_generate_multi_edges_total", multiEdges);
+}
+
+} // namespace
+
+void DegreeSequenceGenerator::ChungLu(
+    const std::vector<size_t>& degrees, const DegreeGenerationOptions& options, Graph& graph
+) {
+    RGG_SCOPED_TIMER("degree_chung_lu_duration_ns");
+    const size_t edgeCount = SumDegrees(degrees) / 2;
+    PrepareGraph(degrees.size(), options, graph);
+    if (edgeCount == 0) return;
+
+    const AliasTable table(std::vector<double>(degrees.begin(), degrees.end()));
+
+    std::vector<uint32_t> from(edgeCount), to(edgeCount);
+    std::vector<int> weights(options.weighted ? edgeCount : 0);
+
+    // Блоки раздаются потокам динамически; содержимое блока зависит только от его номера
+    const size_t blockCount = (edgeCount + kEdgeBlock - 1) / kEdgeBlock;
+    std::atomic<size_t> nextBlock{0};
+    const auto worker = [&]() {
+        for (size_t block = nextBlock++; block < blockCount; block = nextBlock++) {
+            const size_t start = block * kEdgeBlock;
+            const size_t count = std::min(kEdgeBlock, edgeCount - start);
+            BatchRandom rng(BatchRandom::StreamSeed(options.seed, kFirstEdgeStream + block));
+            table.Sample(rng, from.data() + start, count);
+            table.Sample(rng, to.data() + start, count);
+            if (options.weighted) {
+                rng.FillRange(weights.data() + start, count, options.minWeight, options.maxWeight);
+            }
+        }
+    };
+
+    size_t threadCount = options.threads ? options.threads : std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, blockCount);
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    InsertEdges(from, to, weights, options, graph);
+}
+
+void DegreeSequenceGenerator::ConfigurationModel(
+    const std::vector<size_t>& degrees, const DegreeGenerationOptions& options, Graph& graph
+) {
+    RGG_SCOPED_TIMER("degree_configuration_model_duration_ns");
+    const size_t stubCount = SumDegrees(degrees);
+    PrepareGraph(degrees.size(), options, graph);
+    const size_t edgeCount = stubCount / 2;
+    if (edgeCount == 0) return;
+
+    std::vector<uint32_t> stubs;
+    stubs.reserve(stubCount);
+    for (size_t v = 0; v < degrees.size(); ++v) {
+        stubs.insert(stubs.end(), degrees[v], static_cast<uint32_t>(v));
+    }
+
+    // Перемешивание Фишера-Йетса - последовательное, O(1) на полуребро
+    BatchRandom rng(BatchRandom::StreamSeed(options.seed, kFirstEdgeStream));
+    for (size_t i = stubCount - 1; i > 0; --i) {
+        std::swap(stubs[i], stubs[static_cast<size_t>(rng.NextBounded(i + 1))]);
+    }
+
+    std::vector<uint32_t> from(edgeCount), to(edgeCount);
+    for (size_t i = 0; i < edgeCount; ++i) {
+        from[i] = stubs[2 * i];
+        to[i] = stubs[2 * i + 1];
+    }
+    stubs.clear();
+    stubs.shrink_to_fit();
+
+    std::vector<int> weights(options.weighted ? edgeCount : 0);
+    if (options.weighted) {
+        rng.FillRange(weights.data(), edgeCount, options.minWeight, options.maxWeight);
+    }
+
+    InsertEdges(from, to, weights, options, graph);
+}
+
+std::vector<size_t> DegreeSequenceGenerator::PowerLawDegrees(
+    size_t vertexCount, double exponent,
+    size_t minDegree, size_t maxDegree,
+    uint64_t seed
+) {
+    if (minDegree == 0 || minDegree > maxDegree)
+        throw std::invalid_argument("Power-law degree range must satisfy 1 <= min <= max");
+
+    // Обратная функция распределения непрерывного степенного закона на [min, max + 1),
+    // округление вниз даёт дискретную степень из [min, max]
+    const double lo = static_cast<double>(minDegree);
+    const double hi = static_cast<double>(maxDegree) + 1.0;
+    const double a = 1.0 - exponent;
+    const bool logUniform = std::abs(a) < 1e-12;
+    const double loA = logUniform ? std::log(lo) : std::pow(lo, a);
+    const double hiA = logUniform ? std::log(hi) : std::pow(hi, a);
+
+    BatchRandom rng(seed);
+    std::vector<size_t> degrees(vertexCount);
+    for (auto& d : degrees) {
+        const double u = static_cast<double>(rng.Next() >> 11) * 0x1.0p-53;
+        const double x = logUniform ? std::exp(loA + u * (hiA - loA)) : std::pow(loA + u * (hiA - loA), 1.0 / a);
+        d = std::clamp(static_cast<size_t>(x), minDegree, maxDegree);
+    }
+    return degrees;
+}
+
+std::vector<size_t> DegreeSequenceGenerator::DegreesFromHistogram(const std::vector<size_t>& histogram) {
+    std::vector<size_t> degrees;
+    for (size_t d = 0; d < histogram.size(); ++d) {
+        degrees.insert(degrees.end(), histogram[d], d);
+    }
+    return degrees;
+}
+
+std::vector<size_t> DegreeSequenceGenerator::DegreesFromGraph(const Graph& graph, bool directed) {
+    std::vector<size_t> degrees(graph.GetVertexCount());
+    for (size_t v = 0; v < degrees.size(); ++v) {
+        degrees[v] += graph[v].size();
+        if (directed) {
+            for (const auto& [to, w] : graph[v]) {
+                degrees[to]++;
+            }
+        }
+    }
+    return degrees;
+}
@@ -0,0 +1,53 @@
+#ifndef DEGREE_SEQUENCE_GENERATOR_H
+#define DEGREE_SEQUENCE_GENERATOR_H
+
+#include "Graph.h"
+#include <vector>
+
+struct DegreeGenerationOptions {
+    bool weighted = true;
+    int minWeight = 1, maxWeight = 10;
+
+    // Петли (u, u) отбрасываются
+    bool removeSelfLoops = true;
+    // Повторные рёбра отбрасываются (остаётся первое). Если выключено, повторы
+    // не теряются, а складываются в вес ребра - граф хранит не более одного ребра между парой.
+    bool removeMultiEdges = true;
+
+    uint64_t seed = 0;
+    // Число потоков выборки рёбер; 0 - по числу ядер. На результат не влияет.
+    size_t threads = 0;
+};
+
+// Генерация графов с заданным распределением степеней.
+// Степени задают суммарную степень вершины; для направленного графа ребро (u, v)
+// учитывается в степени и u, и v. Граф получает degrees.size() вершин и sum(degrees) / 2
+// выборок рёбер (до удаления петель и повторов).
+class DegreeSequenceGenerator {
+public:
+    // Модель Чанга-Лу: концы каждого ребра независимо выбираются пропорционально степеням
+    // через таблицу Уолкера за O(1). Рёбра генерируются блоками фиксированного размера
+    // параллельно; каждый блок имеет свой поток случайных чисел, поэтому результат
+    // зависит только от seed.
+    static void ChungLu(const std::vector<size_t>& degrees, const DegreeGenerationOptions& options, Graph& graph);
+
+    // Модель конфигураций: полустепени (stubs) перемешиваются и соединяются попарно.
+    // Степени сохраняются точно, кроме удалённых петель и повторов; нечётная сумма
+    // степеней оставляет один полуребро без пары.
+    static void ConfigurationModel(const std::vector<size_t>& degrees, const DegreeGenerationOptions& options, Graph& graph);
+
+    // Степенное распределение P(d) ~ d^-exponent на [minDegree, maxDegree]
+    static std::vector<size_t> PowerLawDegrees(
+        size_t vertexCount, double exponent,
+        size_t minDegree, size_t maxDegree,
+        uint64_t seed
+    );
+
+    // Последовательность по гистограмме: histogram[d] вершин степени d
+    static std::vector<size_t> DegreesFromHistogram(const std::vector<size_t>& histogram);
+
+    // Суммарные степени вершин существующего графа (для направленного - входящие плюс исходящие)
+    static std::vector<size_t> DegreesFromGraph(const Graph& graph, bool directed);
+};
+
+#endif // DEGREE_SEQUENCE_GENERATOR_H
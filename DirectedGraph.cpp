@@ -1,5 +1,8 @@
 #include "DirectedGraph.h"
-#include <random>
+#include "Metrics.h"
+#include "BatchRandom.h"
+#include <algorithm>
+#include <iterator>
 #include <stdexcept>
 
 DirectedGraph::DirectedGraph(bool weighted)
@@ -9,6 +12,10 @@ DirectedGraph::DirectedGraph(bool weighted)
 void DirectedGraph::SetVertexCount(size_t count) {
     adjacency_.clear();
     adjacency_.resize(count);
+    if (inEdgeIndex_) {
+        reverse_.clear();
+        reverse_.resize(count);
+    }
     vertexWeights_.resize(count, 1);
 }
 
@@ -16,16 +23,131 @@ size_t DirectedGraph::GetVertexCount() const {
     return adjacency_.size();
 }
 
+void DirectedGraph::AddVertices(size_t count) {
+    const size_t newCount = GetVertexCount() + count;
+    adjacency_.resize(newCount);
+    if (inEdgeIndex_) {
+        reverse_.resize(newCount);
+    }
+    vertexWeights_.resize(newCount, 1);
+}
+
+void DirectedGraph::Resize(size_t count) {
+    const size_t V = GetVertexCount();
+    if (count >= V) {
+        AddVertices(count - V);
+        return;
+    }
+
+    // Удаляем рёбра между оставшимися и отбрасываемыми вершинами
+    if (inEdgeIndex_) {
+        for (size_t u = count; u < V; ++u) {
+            for (const auto& [to, w] : adjacency_[u]) {
+                if (to < count) reverse_[to].erase(u);
+            }
+            for (const auto& [from, w] : reverse_[u]) {
+                if (from < count) adjacency_[from].erase(u);
+            }
+        }
+        reverse_.resize(count);
+    } else {
+        for (size_t u = 0; u < count; ++u) {
+            auto& edges = adjacency_[u];
+            for (auto it = edges.begin(); it != edges.end();) {
+                it = it->first >= count ? edges.erase(it) : std::next(it);
+            }
+        }
+    }
+    adjacency_.resize(count);
+    vertexWeights_.resize(count);
+}
+
+void DirectedGraph::ClearEdges() {
+    for (auto& edges : adjacency_) {
+        edges.clear();
+    }
+    for (auto& edges : reverse_) {
+        edges.clear();
+    }
+}
+
+void DirectedGraph::RemoveVertex(size_t v) {
+    const size_t V = GetVertexCount();
+    if (v >= V)
+        throw std::out_of_range("Vertex index out of range");
+    const size_t last = V - 1;
+
+    if (inEdgeIndex_) {
+        // Рёбра вершины v
+        for (const auto& [to, w] : adjacency_[v]) {
+            if (to != v) reverse_[to].erase(v);
+        }
+        for (const auto& [from, w] : reverse_[v]) {
+            if (from != v) adjacency_[from].erase(v);
+        }
+        adjacency_[v].clear();
+        reverse_[v].clear();
+
+        // Переименовываем last -> v у соседей последней вершины
+        if (v != last) {
+            std::unordered_map<size_t,int> out, in;
+            for (const auto& [to, w] : adjacency_[last]) {
+                if (to == last) {
+                    out[v] = w;
+                    continue;
+                }
+                out[to] = w;
+                reverse_[to].erase(last);
+                reverse_[to][v] = w;
+            }
+            for (const auto& [from, w] : reverse_[last]) {
+                if (from == last) {
+                    in[v] = w;
+                    continue;
+                }
+                in[from] = w;
+                adjacency_[from].erase(last);
+                adjacency_[from][v] = w;
+            }
+            adjacency_[v] = std::move(out);
+            reverse_[v] = std::move(in);
+        }
+        reverse_.pop_back();
+    } else {
+        // Без индекса входящие рёбра ищем просмотром всех списков смежности
+        adjacency_[v].clear();
+        for (auto& edges : adjacency_) {
+            edges.erase(v);
+            if (v == last) continue;
+            const auto it = edges.find(last);
+            if (it != edges.end()) {
+                const int w = it->second;
+                edges.erase(it);
+                edges[v] = w;
+            }
+        }
+        if (v != last) {
+            adjacency_[v] = std::move(adjacency_[last]);
+        }
+    }
+
+    vertexWeights_[v] = vertexWeights_[last];
+    adjacency_.pop_back();
+    vertexWeights_.pop_back();
+}
+
 void DirectedGraph::AddEdge(size_t from, size_t to, int weight) {
     if (from >= GetVertexCount() || to >= GetVertexCount())
         throw std::out_of_range("Vertex index out of range");
     adjacency_[from][to] = weight;
+    if (inEdgeIndex_) reverse_[to][from] = weight;
 }
 
 void DirectedGraph::RemoveEdge(size_t from, size_t to) {
     if (from >= GetVertexCount() || to >= GetVertexCount())
         return;
     adjacency_[from].erase(to);
+    if (inEdgeIndex_) reverse_[to].erase(from);
 }
 
 bool DirectedGraph::HasEdge(size_t from, size_t to) const {
@@ -44,6 +166,7 @@ void DirectedGraph::SetWeight(size_t from, size_t to, int weight) {
     if (!HasEdge(from, to))
         throw std::runtime_error("Edge does not exist");
     adjacency_[from][to] = weight;
+    if (inEdgeIndex_) reverse_[to][from] = weight;
 }
 
 const std::unordered_map<size_t,int>& DirectedGraph::operator[](size_t vertex) const {
@@ -56,18 +179,21 @@ void DirectedGraph::GenerateRandom(
     size_t minVertices, size_t maxVertices,
     size_t minEdges, size_t maxEdges,
     int minWeight, int maxWeight,
-    bool weighted
+    bool weighted,
+    uint32_t seed
 ) {
+    RGG_SCOPED_TIMER("directed_generate_duration_ns");
+
     // Корректируем диапазоны, если пользователь ввёл неверно
     if (minVertices > maxVertices) std::swap(minVertices, maxVertices);
     if (minEdges > maxEdges) std::swap(minEdges, maxEdges);
 
     weighted_ = weighted;
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    BatchRandom rng(seed);
 
-    std::uniform_int_distribution<size_t> distV(minVertices, maxVertices);
-    size_t vertexCount = distV(gen);
+    size_t vertexCount = static_cast<size_t>(rng.NextInRange(minVertices, maxVertices));
+    if (vertexCount > UINT32_MAX)
+        throw std::length_error("Vertex count exceeds sampling range");
 
     SetVertexCount(vertexCount);
 
@@ -76,29 +202,51 @@ void DirectedGraph::GenerateRandom(
         return;
     }
 
-    std::uniform_int_distribution<size_t> distE(minEdges, maxEdges);
-    size_t edgeCount = distE(gen);
-
-    std::uniform_int_distribution<size_t> distVertex(0, vertexCount - 1);
-    std::uniform_int_distribution<int> distW(minWeight, maxWeight);
+    size_t edgeCount = static_cast<size_t>(rng.NextInRange(minEdges, maxEdges));
+    const auto range = static_cast<uint32_t>(vertexCount);
 
     // Генерация весов вершин (если взвешенный)
     if (weighted_) {
-        for (auto &w : vertexWeights_) {
-            w = distW(gen);
-        }
+        rng.FillRange(vertexWeights_.data(), vertexWeights_.size(), minWeight, maxWeight);
     }
 
-    for (size_t i = 0; i < edgeCount; ++i) {
-        size_t from = distVertex(gen);
-        size_t to = distVertex(gen);
-        // Если случайно получилась петля - сделаем сдвиг только если есть больше 1 вершины
-        if (from == to && vertexCount > 1) {
-            to = (to + 1) % vertexCount;
+    // Концы рёбер и веса генерируются пакетами
+    constexpr size_t kBlock = BatchRandom::kBlockSize;
+    std::vector<uint32_t> fromBlock(kBlock), toBlock(kBlock);
+    std::vector<int> weightBlock(kBlock, 1);
+
+    size_t overwrites = 0;
+    size_t rehashes = 0;
+    for (size_t start = 0; start < edgeCount; start += kBlock) {
+        const size_t count = std::min(kBlock, edgeCount - start);
+        rng.FillBounded(fromBlock.data(), count, range);
+        rng.FillBounded(toBlock.data(), count, range);
+        if (weighted_) {
+            rng.FillRange(weightBlock.data(), count, minWeight, maxWeight);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            size_t from = fromBlock[i];
+            size_t to = toBlock[i];
+            // Если случайно получилась петля - сделаем сдвиг только если есть больше 1 вершины
+            if (from == to && vertexCount > 1) {
+                to = (to + 1) % vertexCount;
+            }
+
+            const auto& edges = adjacency_[from];
+            const size_t sizeBefore = edges.size();
+            const size_t bucketsBefore = edges.bucket_count();
+            AddEdge(from, to, weightBlock[i]);
+            // Повторное ребро перезаписывает вес существующего
+            if (edges.size() == sizeBefore) overwrites++;
+            if (edges.bucket_count() != bucketsBefore) rehashes++;
         }
-        int w = weighted_ ? distW(gen) : 1;
-        AddEdge(from, to, w);
     }
+
+    RGG_COUNTER_ADD("directed_generate_edge_samples_total", edgeCount);
+    RGG_COUNTER_ADD("directed_generate_duplicate_overwrites_total", overwrites);
+    RGG_COUNTER_ADD("directed_generate_rehashes_total", rehashes);
+    RGG_GAUGE_SET("directed_graph_memory_bytes", GetMemoryUsage());
 }
 
 
@@ -111,4 +259,63 @@ void DirectedGraph::SetVertexWeights(const std::vector<int>& weights) {
 int DirectedGraph::GetVertexWeight(size_t v) const {
     if (v >= GetVertexCount()) throw std::out_of_range("Vertex index out of range");
     return vertexWeights_[v];
-}
\ No newline at end of file
+}
+
+size_t DirectedGraph::GetMemoryUsage() const {
+    // Узел unordered_map: указатель на следующий узел, пара ключ-значение и кэшированный хэш
+    constexpr size_t nodeSize = sizeof(void*) + sizeof(std::pair<const size_t,int>) + sizeof(size_t);
+    size_t bytes = sizeof(*this)
+        + adjacency_.capacity() * sizeof(adjacency_[0])
+        + vertexWeights_.capacity() * sizeof(int);
+    for (const auto& edges : adjacency_) {
+        bytes += edges.bucket_count() * sizeof(void*) + edges.size() * nodeSize;
+    }
+    bytes += reverse_.capacity() * sizeof(adjacency_[0]);
+    for (const auto& edges : reverse_) {
+        bytes += edges.bucket_count() * sizeof(void*) + edges.size() * nodeSize;
+    }
+    return bytes;
+}
+
+void DirectedGraph::EnableInEdgeIndex(bool enable) {
+    if (enable == inEdgeIndex_) return;
+    inEdgeIndex_ = enable;
+    reverse_.clear();
+    if (!enable) {
+        reverse_.shrink_to_fit();
+        return;
+    }
+
+    reverse_.resize(GetVertexCount());
+    for (size_t from = 0; from < adjacency_.size(); ++from) {
+        for (const auto& [to, w] : adjacency_[from]) {
+            reverse_[to][from] = w;
+        }
+    }
+}
+
+const std::unordered_map<size_t,int>& DirectedGraph::InEdges(size_t vertex) const {
+    if (!inEdgeIndex_)
+        throw std::logic_error("In-edge index is disabled");
+    if (vertex >= GetVertexCount())
+        throw std::out_of_range("Vertex index out of range");
+    return reverse_[vertex];
+}
+
+std::vector<size_t> DirectedGraph::GetPredecessors(size_t vertex) const {
+    if (vertex >= GetVertexCount())
+        throw std::out_of_range("Vertex index out of range");
+
+    std::vector<size_t> result;
+    if (inEdgeIndex_) {
+        result.reserve(reverse_[vertex].size());
+        for (const auto& [from, w] : reverse_[vertex]) {
+            result.push_back(from);
+        }
+        return result;
+    }
+    for (size_t from = 0; from < adjacency_.size(); ++from) {
+        if (adjacency_[from].count(vertex)) result.push_back(from);
+    }
+    return result;
+}
@@ -11,6 +11,11 @@ public:
     void SetVertexCount(size_t count) override;
     size_t GetVertexCount() const override;
 
+    void AddVertices(size_t count) override;
+    void Resize(size_t count) override;
+    void RemoveVertex(size_t v) override;
+    void ClearEdges() override;
+
     void AddEdge(size_t from, size_t to, int weight = 1) override;
     void RemoveEdge(size_t from, size_t to) override;
     bool HasEdge(size_t from, size_t to) const override;
@@ -24,17 +29,35 @@ public:
         size_t minVertices, size_t maxVertices,
         size_t minEdges, size_t maxEdges,
         int minWeight, int maxWeight,
-        bool weighted
+        bool weighted,
+        uint32_t seed
     ) override;
+    using Graph::GenerateRandom;
 
     void SetVertexWeights(const std::vector<int>& weights) override;
     int GetVertexWeight(size_t v) const override;
     bool IsWeighted() const override { return weighted_; }
+    void SetWeighted(bool weighted) override { weighted_ = weighted; }
+
+    size_t GetMemoryUsage() const override;
+
+    // Индекс входящих рёбер. Поддерживается при всех изменениях графа и позволяет
+    // находить предшественников и удалять вершину за O(входящая + исходящая степень)
+    // ценой удвоения памяти под рёбра. По умолчанию выключен.
+    void EnableInEdgeIndex(bool enable);
+    [[nodiscard]] bool HasInEdgeIndex() const { return inEdgeIndex_; }
+
+    // Входящие рёбра вершины: предшественник -> вес. Требует включённого индекса.
+    [[nodiscard]] const std::unordered_map<size_t,int>& InEdges(size_t vertex) const;
+    // Предшественники вершины; без индекса - просмотром всего графа
+    [[nodiscard]] std::vector<size_t> GetPredecessors(size_t vertex) const;
 
 private:
     std::vector<std::unordered_map<size_t,int>> adjacency_;
+    std::vector<std::unordered_map<size_t,int>> reverse_;
     std::vector<int> vertexWeights_;
     bool weighted_;
+    bool inEdgeIndex_ = false;
 };
 
 #endif // DIRECTED_GRAPH_H
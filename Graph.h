@@ -4,14 +4,27 @@
 #include <unordered_map>
 #include <vector>
 #include <iostream>
+#include <random>
+#include <cstdint>
 
 class Graph {
 public:
     virtual ~Graph() = default;
 
+    // Задаёт число вершин, удаляя все рёбра
     virtual void SetVertexCount(size_t count) = 0;
     [[nodiscard]] virtual size_t GetVertexCount() const = 0;
 
+    // Добавляет count вершин с номерами GetVertexCount().., сохраняя рёбра и веса
+    virtual void AddVertices(size_t count) = 0;
+    // Изменяет число вершин, сохраняя рёбра между оставшимися вершинами
+    virtual void Resize(size_t count) = 0;
+    // Удаляет вершину вместе с её рёбрами. Номера остаются плотными:
+    // последняя вершина получает номер удалённой.
+    virtual void RemoveVertex(size_t v) = 0;
+    // Удаляет все рёбра, сохраняя вершины, их веса и таблицы списков смежности
+    virtual void ClearEdges() = 0;
+
     virtual void AddEdge(size_t from, size_t to, int weight = 1) = 0;
     virtual void RemoveEdge(size_t from, size_t to) = 0;
     [[nodiscard]] virtual bool HasEdge(size_t from, size_t to) const = 0;
@@ -21,17 +34,34 @@ public:
 
     virtual const std::unordered_map<size_t, int>& operator[](size_t vertex) const = 0;
 
+    // Детерминированная генерация: одинаковые параметры и seed дают одинаковый граф
     virtual void GenerateRandom(
         size_t minVertices, size_t maxVertices,
         size_t minEdges, size_t maxEdges,
         int minWeight, int maxWeight,
-        bool weighted
+        bool weighted,
+        uint32_t seed
     ) = 0;
 
+    // Генерация со случайным seed
+    void GenerateRandom(
+        size_t minVertices, size_t maxVertices,
+        size_t minEdges, size_t maxEdges,
+        int minWeight, int maxWeight,
+        bool weighted
+    ) {
+        std::random_device rd;
+        GenerateRandom(minVertices, maxVertices, minEdges, maxEdges, minWeight, maxWeight, weighted, rd());
+    }
+
     // Можно добавить веса вершин, если необходимо:
     virtual void SetVertexWeights(const std::vector<int>& weights) = 0;
     [[nodiscard]] virtual int GetVertexWeight(size_t v) const = 0;
     [[nodiscard]] virtual bool IsWeighted() const = 0;
+    virtual void SetWeighted(bool weighted) = 0;
+
+    // Приблизительный объём памяти, занимаемый структурами графа, в байтах
+    [[nodiscard]] virtual size_t GetMemoryUsage() const = 0;
 };
 
 #endif // GRAPH_H
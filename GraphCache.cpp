@@ -0,0 +1,222 @@
+#include "GraphCache.h"
+#include "GraphIO.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// Увеличивать при любом изменении алгоритма генерации, чтобы старые записи не подходили
+constexpr uint32_t kGeneratorVersion = 2;
+
+constexpr char kExtension[] = ".graph";
+constexpr auto kStaleTempAge = std::chrono::hours(1);
+
+bool ReadFile(const fs::path& path, std::string& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    return !in.bad();
+}
+
+} // namespace
+
+GraphCacheKey GraphCacheKey::Normalized() const {
+    GraphCacheKey key = *this;
+    if (key.minV > key.maxV) std::swap(key.minV, key.maxV);
+    if (key.minE > key.maxE) std::swap(key.minE, key.maxE);
+    return key;
+}
+
+std::string GraphCacheKey::Serialize() const {
+    const GraphCacheKey key = Normalized();
+    std::string out;
+    AppendBinary<uint32_t>(out, kGeneratorVersion);
+    AppendBinary<uint8_t>(out, key.directed ? 1 : 0);
+    AppendBinary<uint64_t>(out, key.minV);
+    AppendBinary<uint64_t>(out, key.maxV);
+    AppendBinary<uint64_t>(out, key.minE);
+    AppendBinary<uint64_t>(out, key.maxE);
+    AppendBinary<int32_t>(out, key.minWeight);
+    AppendBinary<int32_t>(out, key.maxWeight);
+    AppendBinary<uint8_t>(out, key.weighted ? 1 : 0);
+    AppendBinary<uint32_t>(out, key.seed);
+    return out;
+}
+
+std::string GraphCacheKey::FileName() const {
+    const std::string bytes = Serialize();
+    const uint64_t hash = HashBytes(bytes.data(), bytes.size());
+    static constexpr char hex[] = "0123456789abcdef";
+    std::string name(16, '0');
+    for (int i = 0; i < 16; ++i) {
+        name[15 - i] = hex[(hash >> (4 * i)) & 0xF];
+    }
+    return name + kExtension;
+}
+
+GraphCache::GraphCache(fs::path directory, std::uintmax_t maxBytes)
+: directory_(std::move(directory)), maxBytes_(maxBytes)
+{
+    std::error_code ec;
+    fs::create_directories(directory_, ec);
+}
+
+// Формат записи: [размер ключа][ключ][хэш данных][данные графа]
+bool GraphCache::Load(const GraphCacheKey& key, Graph& graph) {
+    const fs::path path = directory_ / key.FileName();
+    std::string file;
+    if (!ReadFile(path, file)) return false;
+
+    const std::string keyBytes = key.Serialize();
+    const size_t headerSize = sizeof(uint32_t) + keyBytes.size() + sizeof(uint64_t);
+    if (file.size() < headerSize) return false;
+
+    uint32_t keySize;
+    std::memcpy(&keySize, file.data(), sizeof(keySize));
+    // Совпадение имени файла ещё не означает совпадение ключа — сравниваем полностью
+    if (keySize != keyBytes.size()
+        || file.compare(sizeof(uint32_t), keyBytes.size(), keyBytes) != 0)
+        return false;
+
+    uint64_t checksum;
+    std::memcpy(&checksum, file.data() + sizeof(uint32_t) + keyBytes.size(), sizeof(checksum));
+    const std::string payload = file.substr(headerSize);
+    if (HashBytes(payload.data(), payload.size()) != checksum) return false;
+
+    try {
+        ReadGraphBinary(payload, graph, key.directed);
+    } catch (const std::runtime_error&) {
+        return false;
+    }
+
+    // Отмечаем обращение для LRU-вытеснения; ошибка не критична
+    std::error_code ec;
+    fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+    return true;
+}
+
+void GraphCache::Store(const GraphCacheKey& key, const Graph& graph) {
+    const std::string keyBytes = key.Serialize();
+    const std::string payload = WriteGraphBinary(graph, key.directed);
+
+    std::string file;
+    file.reserve(sizeof(uint32_t) + keyBytes.size() + sizeof(uint64_t) + payload.size());
+    AppendBinary<uint32_t>(file, static_cast<uint32_t>(keyBytes.size()));
+    file += keyBytes;
+    AppendBinary<uint64_t>(file, HashBytes(payload.data(), payload.size()));
+    file += payload;
+
+    // Запись не помещается в кэш целиком — не сохраняем её вовсе
+    if (file.size() > maxBytes_) return;
+
+    // Уникальное имя временного файла, чтобы параллельные процессы не писали в один файл
+    std::random_device rd;
+    const fs::path finalPath = directory_ / key.FileName();
+    fs::path tempPath = finalPath;
+    tempPath += ".tmp." + std::to_string(rd()) + std::to_string(rd());
+
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out) return;
+        out.write(file.data(), static_cast<std::streamsize>(file.size()));
+        if (!out) {
+            out.close();
+            std::error_code ec;
+            fs::remove(tempPath, ec);
+            return;
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tempPath, finalPath, ec);
+    if (ec) {
+        fs::remove(tempPath, ec);
+        return;
+    }
+
+    Evict();
+}
+
+void GraphCache::GetOrGenerate(const GraphCacheKey& key, Graph& graph) {
+    if (Load(key, graph)) {
+        RGG_COUNTER_ADD("graph_cache_hits_total", 1);
+        return;
+    }
+    RGG_COUNTER_ADD("graph_cache_misses_total", 1);
+
+    graph.GenerateRandom(
+        key.minV, key.maxV,
+        key.minE, key.maxE,
+        key.minWeight, key.maxWeight,
+        key.weighted,
+        key.seed
+    );
+    Store(key, graph);
+}
+
+void GraphCache::Clear() {
+    std::error_code ec;
+    for (fs::directory_iterator it(directory_, ec), end; !ec && it != end; it.increment(ec)) {
+        const auto name = it->path().filename().string();
+        if (name.find(kExtension) != std::string::npos) {
+            std::error_code removeEc;
+            fs::remove(it->path(), removeEc);
+        }
+    }
+}
+
+void GraphCache::Evict() {
+    struct Entry {
+        fs::path path;
+        std::uintmax_t size;
+        fs::file_time_type time;
+    };
+    std::vector<Entry> entries;
+    std::uintmax_t total = 0;
+    const auto now = fs::file_time_type::clock::now();
+
+    // Другие процессы могут удалять файлы одновременно с нами, поэтому все ошибки
+    // файловой системы просто пропускаем
+    std::error_code ec;
+    for (fs::directory_iterator it(directory_, ec), end; !ec && it != end; it.increment(ec)) {
+        std::error_code entryEc;
+        const fs::path& path = it->path();
+        const auto time = fs::last_write_time(path, entryEc);
+        if (entryEc) continue;
+
+        const std::string name = path.filename().string();
+        if (name.find(std::string(kExtension) + ".tmp.") != std::string::npos) {
+            // Временный файл упавшего процесса
+            if (now - time > kStaleTempAge) fs::remove(path, entryEc);
+            continue;
+        }
+        if (path.extension() != kExtension) continue;
+
+        const auto size = fs::file_size(path, entryEc);
+        if (entryEc) continue;
+        entries.push_back({path, size, time});
+        total += size;
+    }
+
+    if (total <= maxBytes_) return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.time < b.time;
+    });
+    for (const auto& entry : entries) {
+        if (total <= maxBytes_) break;
+        std::error_code removeEc;
+        fs::remove(entry.path, removeEc);
+        total -= entry.size;
+        RGG_COUNTER_ADD("graph_cache_evictions_total", 1);
+    }
+}
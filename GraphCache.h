@@ -0,0 +1,53 @@
+#ifndef GRAPH_CACHE_H
+#define GRAPH_CACHE_H
+
+#include "Graph.h"
+#include <filesystem>
+#include <string>
+
+// Полный набор параметров, однозначно определяющий результат GenerateRandom
+struct GraphCacheKey {
+    bool directed = true;
+    size_t minV = 0, maxV = 0;
+    size_t minE = 0, maxE = 0;
+    int minWeight = 1, maxWeight = 1;
+    bool weighted = true;
+    uint32_t seed = 0;
+
+    // Диапазоны приводятся к виду min <= max так же, как это делает GenerateRandom
+    [[nodiscard]] GraphCacheKey Normalized() const;
+    // Каноническое бинарное представление ключа (включает версию генератора)
+    [[nodiscard]] std::string Serialize() const;
+    // Имя файла в кэше: hex-хэш сериализованного ключа
+    [[nodiscard]] std::string FileName() const;
+};
+
+// Дисковый кэш сгенерированных графов.
+// Файлы записываются во временный файл и атомарно переименовываются, поэтому несколько
+// процессов могут одновременно читать и пополнять один каталог. Повреждённые или
+// недочитанные записи считаются промахом. При превышении лимита размера удаляются
+// записи, к которым дольше всего не обращались.
+class GraphCache {
+public:
+    explicit GraphCache(std::filesystem::path directory, std::uintmax_t maxBytes = 256ull * 1024 * 1024);
+
+    // Загружает граф из кэша. Возвращает false при промахе.
+    bool Load(const GraphCacheKey& key, Graph& graph);
+    // Сохраняет граф в кэш и при необходимости вытесняет старые записи
+    void Store(const GraphCacheKey& key, const Graph& graph);
+    // Загружает граф из кэша либо генерирует его и сохраняет
+    void GetOrGenerate(const GraphCacheKey& key, Graph& graph);
+
+    void Clear();
+
+    [[nodiscard]] const std::filesystem::path& GetDirectory() const { return directory_; }
+    [[nodiscard]] std::uintmax_t GetMaxBytes() const { return maxBytes_; }
+
+private:
+    std::filesystem::path directory_;
+    std::uintmax_t maxBytes_;
+
+    void Evict();
+};
+
+#endif // GRAPH_CACHE_H
@@ -0,0 +1,117 @@
+#include "GraphIO.h"
+#include <limits>
+
+namespace {
+
+constexpr uint32_t kMagic = 0x48505247; // "GRPH"
+constexpr uint16_t kVersion = 1;
+
+constexpr uint16_t kFlagDirected = 1 << 0;
+constexpr uint16_t kFlagWeighted = 1 << 1;
+constexpr uint16_t kFlagWideIndex = 1 << 2;
+
+} // namespace
+
+uint64_t HashBytes(const char* data, size_t size, uint64_t hash) {
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+std::string WriteGraphBinary(const Graph& graph, bool directed) {
+    const size_t V = graph.GetVertexCount();
+    const bool wide = V > std::numeric_limits<uint32_t>::max();
+
+    // Ненаправленные рёбра хранятся в обоих списках смежности, пишем только from <= to
+    uint64_t edgeCount = 0;
+    for (size_t v = 0; v < V; ++v) {
+        for (const auto& [to, w] : graph[v]) {
+            if (directed || v <= to) edgeCount++;
+        }
+    }
+
+    uint16_t flags = 0;
+    if (directed) flags |= kFlagDirected;
+    if (graph.IsWeighted()) flags |= kFlagWeighted;
+    if (wide) flags |= kFlagWideIndex;
+
+    const size_t indexSize = wide ? sizeof(uint64_t) : sizeof(uint32_t);
+    std::string out;
+    out.reserve(24 + (graph.IsWeighted() ? V * sizeof(int32_t) : 0)
+                + edgeCount * (2 * indexSize + sizeof(int32_t)));
+
+    AppendBinary<uint32_t>(out, kMagic);
+    AppendBinary<uint16_t>(out, kVersion);
+    AppendBinary<uint16_t>(out, flags);
+    AppendBinary<uint64_t>(out, V);
+    AppendBinary<uint64_t>(out, edgeCount);
+
+    if (graph.IsWeighted()) {
+        for (size_t v = 0; v < V; ++v) {
+            AppendBinary<int32_t>(out, graph.GetVertexWeight(v));
+        }
+    }
+
+    for (size_t v = 0; v < V; ++v) {
+        for (const auto& [to, w] : graph[v]) {
+            if (!directed && v > to) continue;
+            if (wide) {
+                AppendBinary<uint64_t>(out, v);
+                AppendBinary<uint64_t>(out, to);
+            } else {
+                AppendBinary<uint32_t>(out, static_cast<uint32_t>(v));
+                AppendBinary<uint32_t>(out, static_cast<uint32_t>(to));
+            }
+            AppendBinary<int32_t>(out, w);
+        }
+    }
+    return out;
+}
+
+void ReadGraphBinary(const std::string& data, Graph& graph, bool directed) {
+    BinaryReader in(data);
+    if (in.Get<uint32_t>() != kMagic)
+        throw std::runtime_error("Not a graph file");
+    if (in.Get<uint16_t>() != kVersion)
+        throw std::runtime_error("Unsupported graph file version");
+
+    const auto flags = in.Get<uint16_t>();
+    if (((flags & kFlagDirected) != 0) != directed)
+        throw std::runtime_error("Graph directedness mismatch");
+    const bool weighted = (flags & kFlagWeighted) != 0;
+    const bool wide = (flags & kFlagWideIndex) != 0;
+
+    const auto V = in.Get<uint64_t>();
+    const auto edgeCount = in.Get<uint64_t>();
+
+    // Проверяем размер до выделения памяти, чтобы испорченный заголовок не привёл к огромной аллокации
+    const uint64_t indexSize = wide ? sizeof(uint64_t) : sizeof(uint32_t);
+    const uint64_t edgeSize = 2 * indexSize + sizeof(int32_t);
+    const uint64_t weightsSize = weighted ? V * sizeof(int32_t) : 0;
+    if ((weighted && V > in.Remaining() / sizeof(int32_t))
+        || edgeCount > (in.Remaining() - weightsSize) / edgeSize
+        || in.Remaining() != weightsSize + edgeCount * edgeSize)
+        throw std::runtime_error("Graph data size mismatch");
+
+    graph.SetVertexCount(static_cast<size_t>(V));
+    graph.SetWeighted(weighted);
+
+    if (weighted) {
+        std::vector<int> weights(static_cast<size_t>(V));
+        for (auto& w : weights) {
+            w = in.Get<int32_t>();
+        }
+        graph.SetVertexWeights(weights);
+    }
+
+    for (uint64_t i = 0; i < edgeCount; ++i) {
+        const uint64_t from = wide ? in.Get<uint64_t>() : in.Get<uint32_t>();
+        const uint64_t to = wide ? in.Get<uint64_t>() : in.Get<uint32_t>();
+        const int w = in.Get<int32_t>();
+        if (from >= V || to >= V)
+            throw std::runtime_error("Graph data contains invalid vertex index");
+        graph.AddEdge(static_cast<size_t>(from), static_cast<size_t>(to), w);
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef GRAPH_IO_H
+#define GRAPH_IO_H
+
+#include "Graph.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// Компактный бинарный формат графа.
+// Заголовок: сигнатура, версия, флаги (направленность, взвешенность, ширина индексов),
+// число вершин и рёбер. Далее веса вершин (только для взвешенных графов)
+// и список рёбер (from, to, weight). Для ненаправленного графа каждое ребро пишется один раз.
+// Индексы вершин хранятся в 32 битах, если число вершин это позволяет.
+
+// Сериализует граф в строку
+std::string WriteGraphBinary(const Graph& graph, bool directed);
+
+// Восстанавливает граф из буфера. Бросает std::runtime_error при повреждённых данных
+// или если направленность записи не совпадает с ожидаемой.
+void ReadGraphBinary(const std::string& data, Graph& graph, bool directed);
+
+// Хэш FNV-1a (64 бита) для контроля целостности файлов.
+// Передавая предыдущий результат в hash, можно хэшировать данные по частям.
+uint64_t HashBytes(const char* data, size_t size, uint64_t hash = 14695981039346656037ull);
+
+// Дописывает значение в буфер в машинном представлении
+template <typename T>
+void AppendBinary(std::string& out, T value) {
+    char buf[sizeof(T)];
+    std::memcpy(buf, &value, sizeof(T));
+    out.append(buf, sizeof(T));
+}
+
+// Последовательное чтение значений из буфера с проверкой границ
+class BinaryReader {
+public:
+    explicit BinaryReader(const std::string& data) : data_(data) {}
+
+    template <typename T>
+    T Get() {
+        if (data_.size() - pos_ < sizeof(T))
+            throw std::runtime_error("Unexpected end of graph data");
+        T value;
+        std::memcpy(&value, data_.data() + pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return value;
+    }
+
+    [[nodiscard]] size_t Remaining() const { return data_.size() - pos_; }
+
+private:
+    const std::string& data_;
+    size_t pos_ = 0;
+};
+
+#endif // GRAPH_IO_H
@@ -0,0 +1,163 @@
+#include "GraphQuery.h"
+#include "BatchRandom.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+void GraphQuery::Begin(size_t vertexCount) {
+    if (stamp_.size() < vertexCount) {
+        stamp_.resize(vertexCount, 0);
+        localId_.resize(vertexCount, 0);
+    }
+    // При переполнении эпохи старые метки могли бы совпасть с новой - очищаем один раз
+    if (++epoch_ == 0) {
+        std::fill(stamp_.begin(), stamp_.end(), 0);
+        epoch_ = 1;
+    }
+    selected_.clear();
+}
+
+bool GraphQuery::Visit(size_t v) {
+    if (IsVisited(v)) return false;
+    stamp_[v] = epoch_;
+    localId_[v] = selected_.size();
+    selected_.push_back(v);
+    return true;
+}
+
+void GraphQuery::BuildInduced(const Graph& source, Graph& out) {
+    const size_t n = selected_.size();
+    // Рёбра удаляются до изменения размера, чтобы Resize не искал рёбра к отбрасываемым
+    // вершинам; списки смежности оставшихся вершин сохраняют свои таблицы
+    out.ClearEdges();
+    out.Resize(n);
+    out.SetWeighted(source.IsWeighted());
+
+    weights_.resize(n);
+    for (size_t i = 0; i < n; ++i) {
+        weights_[i] = source.GetVertexWeight(selected_[i]);
+    }
+    out.SetVertexWeights(weights_);
+
+    for (size_t i = 0; i < n; ++i) {
+        for (const auto& [to, w] : source[selected_[i]]) {
+            if (IsVisited(to)) {
+                out.AddEdge(i, localId_[to], w);
+            }
+        }
+    }
+}
+
+const std::vector<size_t>& GraphQuery::EgoNetwork(const Graph& source, size_t center, size_t hops, Graph& out) {
+    RGG_SCOPED_TIMER("query_ego_network_duration_ns");
+    if (center >= source.GetVertexCount())
+        throw std::out_of_range("Vertex index out of range");
+
+    Begin(source.GetVertexCount());
+    Visit(center);
+    frontier_.assign(1, center);
+
+    // Обход в ширину по слоям
+    for (size_t depth = 0; depth < hops && !frontier_.empty(); ++depth) {
+        next_.clear();
+        for (size_t v : frontier_) {
+            for (const auto& [to, w] : source[v]) {
+                if (Visit(to)) next_.push_back(to);
+            }
+        }
+        frontier_.swap(next_);
+    }
+
+    BuildInduced(source, out);
+    return selected_;
+}
+
+const std::vector<size_t>& GraphQuery::InducedSubgraph(
+    const Graph& source, const std::vector<size_t>& vertices, Graph& out
+) {
+    RGG_SCOPED_TIMER("query_induced_subgraph_duration_ns");
+    Begin(source.GetVertexCount());
+    for (size_t v : vertices) {
+        if (v >= source.GetVertexCount())
+            throw std::out_of_range("Vertex index out of range");
+        Visit(v);
+    }
+
+    BuildInduced(source, out);
+    return selected_;
+}
+
+const std::vector<size_t>& GraphQuery::RandomWalkSample(
+    const Graph& source, size_t start,
+    size_t maxVertices, size_t maxSteps,
+    uint64_t seed, Graph& out
+) {
+    RGG_SCOPED_TIMER("query_random_walk_duration_ns");
+    if (start >= source.GetVertexCount())
+        throw std::out_of_range("Vertex index out of range");
+
+    BatchRandom rng(seed);
+    Begin(source.GetVertexCount());
+    Visit(start);
+
+    size_t current = start;
+    for (size_t step = 0; step < maxSteps && selected_.size() < maxVertices; ++step) {
+        const auto& edges = source[current];
+        if (edges.empty()) {
+            current = start;
+            continue;
+        }
+        // unordered_map не даёт произвольного доступа - продвигаем итератор
+        auto it = edges.begin();
+        std::advance(it, static_cast<std::ptrdiff_t>(rng.NextBounded(edges.size())));
+        current = it->first;
+        Visit(current);
+    }
+
+    BuildInduced(source, out);
+    return selected_;
+}
+
+const std::vector<size_t>& GraphQuery::SnowballSample(
+    const Graph& source, const std::vector<size_t>& seeds,
+    size_t fanout, size_t waves,
+    uint64_t seed, Graph& out
+) {
+    RGG_SCOPED_TIMER("query_snowball_duration_ns");
+    BatchRandom rng(seed);
+    Begin(source.GetVertexCount());
+
+    frontier_.clear();
+    for (size_t v : seeds) {
+        if (v >= source.GetVertexCount())
+            throw std::out_of_range("Vertex index out of range");
+        if (Visit(v)) frontier_.push_back(v);
+    }
+
+    for (size_t wave = 0; wave < waves && !frontier_.empty(); ++wave) {
+        next_.clear();
+        for (size_t v : frontier_) {
+            // Равномерно выбираем до fanout непосещённых соседей (reservoir sampling)
+            candidates_.clear();
+            size_t seen = 0;
+            for (const auto& [to, w] : source[v]) {
+                if (IsVisited(to)) continue;
+                if (candidates_.size() < fanout) {
+                    candidates_.push_back(to);
+                } else {
+                    const auto j = static_cast<size_t>(rng.NextBounded(seen + 1));
+                    if (j < fanout) candidates_[j] = to;
+                }
+                seen++;
+            }
+            for (size_t to : candidates_) {
+                if (Visit(to)) next_.push_back(to);
+            }
+        }
+        frontier_.swap(next_);
+    }
+
+    BuildInduced(source, out);
+    return selected_;
+}
@@ -0,0 +1,58 @@
+#ifndef GRAPH_QUERY_H
+#define GRAPH_QUERY_H
+
+#include "Graph.h"
+#include <vector>
+
+// Выборка подграфов для исследования больших графов: k-окрестности вершины,
+// индуцированные подграфы, выборки случайным блужданием и методом «снежного кома».
+//
+// Результат записывается в переданный граф out с вершинами 0..n-1; возвращаемый вектор
+// сопоставляет новой вершине её номер в исходном графе и действителен до следующего запроса.
+// Метки посещения и рабочие буферы переиспользуются между запросами: метки сбрасываются
+// сменой эпохи, а не очисткой, поэтому повторный запрос не выделяет память под них.
+// Граф out тоже переиспользуется: его списки смежности очищаются, а не создаются заново,
+// так что память выделяется только под сами рёбра и под вершины сверх прежнего размера out.
+// Для направленного графа обход идёт по исходящим рёбрам.
+class GraphQuery {
+public:
+    // Вершины на расстоянии не более hops от center
+    const std::vector<size_t>& EgoNetwork(const Graph& source, size_t center, size_t hops, Graph& out);
+
+    // Подграф, индуцированный заданным набором вершин (повторы игнорируются)
+    const std::vector<size_t>& InducedSubgraph(const Graph& source, const std::vector<size_t>& vertices, Graph& out);
+
+    // Случайное блуждание из start с возвратом в start из тупиков.
+    // Останавливается, набрав maxVertices различных вершин или сделав maxSteps шагов.
+    const std::vector<size_t>& RandomWalkSample(
+        const Graph& source, size_t start,
+        size_t maxVertices, size_t maxSteps,
+        uint64_t seed, Graph& out
+    );
+
+    // «Снежный ком»: на каждой из waves волн от каждой вершины фронта берётся
+    // не более fanout случайных ещё не посещённых соседей
+    const std::vector<size_t>& SnowballSample(
+        const Graph& source, const std::vector<size_t>& seeds,
+        size_t fanout, size_t waves,
+        uint64_t seed, Graph& out
+    );
+
+private:
+    std::vector<uint32_t> stamp_;     // эпоха последнего посещения вершины
+    std::vector<size_t> localId_;     // номер вершины в результирующем подграфе
+    uint32_t epoch_ = 0;
+
+    std::vector<size_t> selected_;
+    std::vector<size_t> frontier_;
+    std::vector<size_t> next_;
+    std::vector<size_t> candidates_;
+    std::vector<int> weights_;
+
+    void Begin(size_t vertexCount);
+    bool Visit(size_t v);
+    [[nodiscard]] bool IsVisited(size_t v) const { return stamp_[v] == epoch_; }
+    void BuildInduced(const Graph& source, Graph& out);
+};
+
+#endif // GRAPH_QUERY_H
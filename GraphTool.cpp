@@ -0,0 +1,128 @@
+// Консольная утилита для пакетной работы с графами без графического интерфейса.
+//
+//   GraphTool generate <параметры>                        - генерация в одном процессе
+//   GraphTool shard <prefix> <shard> <shards> <параметры> - генерация одного шарда
+//   GraphTool merge <prefix> [directed=0|1]                - сборка графа из шардов
+//
+// Параметры задаются как key=value: directed, weighted, minV, maxV, minE, maxE, minW, maxW, seed.
+// Команды generate и merge печатают сводку графа; совпадение digest означает совпадение графов.
+#include "DirectedGraph.h"
+#include "UndirectedGraph.h"
+#include "GraphIO.h"
+#include "ShardedGenerator.h"
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+void PrintUsage() {
+    std::cerr << "Usage:\n"
+              << "  GraphTool generate [key=value...]\n"
+              << "  GraphTool shard <prefix> <shard> <shards> [key=value...]\n"
+              << "  GraphTool merge <prefix> [directed=0|1]\n"
+              << "Keys: directed, weighted, minV, maxV, minE, maxE, minW, maxW, seed\n";
+}
+
+ShardParams ParseParams(int argc, char* argv[], int first) {
+    ShardParams params;
+    params.minV = params.maxV = 10;
+    params.minE = params.maxE = 20;
+    params.maxWeight = 10;
+    for (int i = first; i < argc; ++i) {
+        const std::string arg = argv[i];
+        const auto eq = arg.find('=');
+        if (eq == std::string::npos)
+            throw std::invalid_argument("Expected key=value, got '" + arg + "'");
+        const std::string key = arg.substr(0, eq);
+        const std::string value = arg.substr(eq + 1);
+        if (key == "directed") params.directed = std::stoi(value) != 0;
+        else if (key == "weighted") params.weighted = std::stoi(value) != 0;
+        else if (key == "minV") params.minV = std::stoull(value);
+        else if (key == "maxV") params.maxV = std::stoull(value);
+        else if (key == "minE") params.minE = std::stoull(value);
+        else if (key == "maxE") params.maxE = std::stoull(value);
+        else if (key == "minW") params.minWeight = std::stoi(value);
+        else if (key == "maxW") params.maxWeight = std::stoi(value);
+        else if (key == "seed") params.seed = std::stoull(value);
+        else throw std::invalid_argument("Unknown parameter '" + key + "'");
+    }
+    return params;
+}
+
+std::unique_ptr<Graph> MakeGraph(bool directed) {
+    if (directed) return std::make_unique<DirectedGraph>(true);
+    return std::make_unique<UndirectedGraph>(true);
+}
+
+// Хэш графа, не зависящий от порядка рёбер в хэш-таблицах
+uint64_t GraphDigest(const Graph& graph, bool directed) {
+    std::vector<std::tuple<size_t, size_t, int>> edges;
+    for (size_t v = 0; v < graph.GetVertexCount(); ++v) {
+        for (const auto& [to, w] : graph[v]) {
+            if (directed || v <= to) edges.emplace_back(v, to, w);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+
+    std::string data;
+    AppendBinary<uint64_t>(data, graph.GetVertexCount());
+    AppendBinary<uint8_t>(data, graph.IsWeighted() ? 1 : 0);
+    for (size_t v = 0; v < graph.GetVertexCount(); ++v) {
+        AppendBinary<int32_t>(data, graph.GetVertexWeight(v));
+    }
+    for (const auto& [from, to, w] : edges) {
+        AppendBinary<uint64_t>(data, from);
+        AppendBinary<uint64_t>(data, to);
+        AppendBinary<int32_t>(data, w);
+    }
+    return HashBytes(data.data(), data.size());
+}
+
+void PrintSummary(const Graph& graph, bool directed) {
+    size_t edges = 0;
+    for (size_t v = 0; v < graph.GetVertexCount(); ++v) {
+        edges += graph[v].size();
+    }
+    if (!directed) edges /= 2;
+    std::cout << "vertices=" << graph.GetVertexCount() << '\n'
+              << "edges=" << edges << '\n'
+              << "digest=" << GraphDigest(graph, directed) << '\n';
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    try {
+        const std::string command = argv[1];
+        if (command == "generate") {
+            const ShardParams params = ParseParams(argc, argv, 2);
+            auto graph = MakeGraph(params.directed);
+            ShardedGenerator(params).GenerateAll(*graph);
+            PrintSummary(*graph, params.directed);
+        } else if (command == "shard" && argc >= 5) {
+            const ShardParams params = ParseParams(argc, argv, 5);
+            ShardedGenerator(params).WriteShard(std::stoull(argv[3]), std::stoull(argv[4]), argv[2]);
+        } else if (command == "merge" && argc >= 3) {
+            const bool directed = ParseParams(argc, argv, 3).directed;
+            auto graph = MakeGraph(directed);
+            ShardedGenerator::LoadShards(argv[2], *graph, directed);
+            PrintSummary(*graph, directed);
+        } else {
+            PrintUsage();
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
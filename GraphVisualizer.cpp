@@ -1,4 +1,5 @@
 #include "GraphVisualizer.h"
+#include "Metrics.h"
 #include <cmath>
 #include <algorithm>
 #include <string>
@@ -12,6 +13,7 @@ GraphVisualizer::GraphVisualizer(Graph& graph, bool directed)
 {}
 
 void GraphVisualizer::LayoutVertices(RECT clientRect) {
+    RGG_SCOPED_TIMER("visualizer_layout_duration_ns");
     vertexPositions_.clear();
     size_t V = graph_.GetVertexCount();
     if (V == 0) return;
@@ -36,6 +38,7 @@ void GraphVisualizer::LayoutVertices(RECT clientRect) {
 }
 
 void GraphVisualizer::Draw(HDC hdc) {
+    RGG_SCOPED_TIMER("visualizer_draw_duration_ns");
     const size_t V = graph_.GetVertexCount();
     if (V == 0) return;
 
@@ -135,7 +138,7 @@ void GraphVisualizer::Draw(HDC hdc) {
         Ellipse(hdc, x-15, y-15, x+15, y+15);
 
         // Отображаем номер вершины
-        std::wstring vertexText = std::to_wstring(v);
+        std::wstring vertexText = std::to_wstring(v < vertexLabels_.size() ? vertexLabels_[v] : v);
         DrawTextCentered(hdc, x, y, vertexText);
 
         // Если взвешенный граф, отображаем вес вершины над ней
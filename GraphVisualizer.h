@@ -27,9 +27,14 @@ public:
 
     void SetDirected(bool directed) { directed_ = directed; }
 
+    // Подписи вершин вместо их номеров (например, номера в исходном графе для подграфа)
+    void SetVertexLabels(const std::vector<size_t>& labels) { vertexLabels_ = labels; }
+    [[nodiscard]] const std::vector<size_t>& GetVertexLabels() const { return vertexLabels_; }
+
 private:
     Graph& graph_;
     std::vector<VertexPosition> vertexPositions_;
+    std::vector<size_t> vertexLabels_;
     bool directed_;
 
     int selectedVertex_ = -1;
@@ -0,0 +1,137 @@
+#include "Metrics.h"
+#include <sstream>
+
+namespace {
+
+size_t BucketIndex(uint64_t value) {
+    // Номер старшего значащего бита + 1: 0 -> 0, 1 -> 1, 2..3 -> 2, ...
+    size_t index = 0;
+    while (value != 0 && index < MetricHistogram::kBucketCount - 1) {
+        value >>= 1;
+        ++index;
+    }
+    return index;
+}
+
+// Верхняя граница корзины i (не включительно): 2^i. Последняя корзина не ограничена.
+uint64_t BucketBound(size_t i) {
+    return i >= MetricHistogram::kBucketCount - 1 ? UINT64_MAX : (uint64_t{1} << i);
+}
+
+size_t LastUsedBucket(const MetricHistogram& h) {
+    size_t last = 0;
+    for (size_t i = 0; i < MetricHistogram::kBucketCount; ++i) {
+        if (h.GetBucket(i) != 0) last = i;
+    }
+    return last;
+}
+
+template <typename Map>
+auto& GetOrCreate(Map& map, const std::string& name) {
+    auto& slot = map[name];
+    if (!slot) slot = std::make_unique<typename Map::mapped_type::element_type>();
+    return *slot;
+}
+
+} // namespace
+
+void MetricHistogram::Observe(uint64_t value) {
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+}
+
+void MetricHistogram::Reset() {
+    for (auto& b : buckets_) {
+        b.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+}
+
+MetricsRegistry& MetricsRegistry::Instance() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+MetricCounter& MetricsRegistry::GetCounter(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return GetOrCreate(counters_, name);
+}
+
+MetricGauge& MetricsRegistry::GetGauge(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return GetOrCreate(gauges_, name);
+}
+
+MetricHistogram& MetricsRegistry::GetHistogram(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return GetOrCreate(histograms_, name);
+}
+
+std::string MetricsRegistry::ToJson() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream out;
+
+    out << "{\"counters\":{";
+    bool first = true;
+    for (const auto& [name, counter] : counters_) {
+        out << (first ? "" : ",") << '"' << name << "\":" << counter->Get();
+        first = false;
+    }
+
+    out << "},\"gauges\":{";
+    first = true;
+    for (const auto& [name, gauge] : gauges_) {
+        out << (first ? "" : ",") << '"' << name << "\":" << gauge->Get();
+        first = false;
+    }
+
+    out << "},\"histograms\":{";
+    first = true;
+    for (const auto& [name, h] : histograms_) {
+        out << (first ? "" : ",") << '"' << name << "\":{\"count\":" << h->GetCount()
+            << ",\"sum\":" << h->GetSum() << ",\"buckets\":[";
+        const size_t last = LastUsedBucket(*h);
+        for (size_t i = 0; i <= last; ++i) {
+            out << (i ? "," : "") << "{\"lt\":" << BucketBound(i) << ",\"count\":" << h->GetBucket(i) << '}';
+        }
+        out << "]}";
+        first = false;
+    }
+    out << "}}";
+    return out.str();
+}
+
+std::string MetricsRegistry::ToPrometheus() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::ostringstream out;
+
+    for (const auto& [name, counter] : counters_) {
+        out << "# TYPE " << name << " counter\n" << name << ' ' << counter->Get() << '\n';
+    }
+    for (const auto& [name, gauge] : gauges_) {
+        out << "# TYPE " << name << " gauge\n" << name << ' ' << gauge->Get() << '\n';
+    }
+    for (const auto& [name, h] : histograms_) {
+        out << "# TYPE " << name << " histogram\n";
+        // Корзины Prometheus кумулятивны и включают верхнюю границу: значения < 2^i это <= 2^i - 1
+        uint64_t cumulative = 0;
+        const size_t last = LastUsedBucket(*h);
+        for (size_t i = 0; i <= last; ++i) {
+            cumulative += h->GetBucket(i);
+            out << name << "_bucket{le=\"" << BucketBound(i) - 1 << "\"} " << cumulative << '\n';
+        }
+        out << name << "_bucket{le=\"+Inf\"} " << h->GetCount() << '\n';
+        out << name << "_sum " << h->GetSum() << '\n';
+        out << name << "_count " << h->GetCount() << '\n';
+    }
+    return out.str();
+}
+
+void MetricsRegistry::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [name, counter] : counters_) counter->Reset();
+    for (auto& [name, gauge] : gauges_) gauge->Reset();
+    for (auto& [name, h] : histograms_) h->Reset();
+}
@@ -0,0 +1,137 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Счётчик: монотонно растущее значение (число событий)
+class MetricCounter {
+public:
+    void Add(uint64_t n = 1) { value_.fetch_add(n, std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t Get() const { return value_.load(std::memory_order_relaxed); }
+    void Reset() { value_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_{0};
+};
+
+// Текущее значение величины (например, объём памяти графа)
+class MetricGauge {
+public:
+    void Set(int64_t value) { value_.store(value, std::memory_order_relaxed); }
+    [[nodiscard]] int64_t Get() const { return value_.load(std::memory_order_relaxed); }
+    void Reset() { value_.store(0, std::memory_order_relaxed); }
+
+private:
+    std::atomic<int64_t> value_{0};
+};
+
+// Гистограмма с логарифмическими корзинами: корзина i содержит значения < 2^i
+class MetricHistogram {
+public:
+    static constexpr size_t kBucketCount = 64;
+
+    void Observe(uint64_t value);
+    [[nodiscard]] uint64_t GetCount() const { return count_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetSum() const { return sum_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t GetBucket(size_t i) const { return buckets_[i].load(std::memory_order_relaxed); }
+    void Reset();
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+};
+
+// Глобальный реестр метрик. Метрики создаются при первом обращении по имени и живут
+// до конца программы, поэтому ссылки на них можно кэшировать.
+// Имена должны соответствовать формату Prometheus: [a-zA-Z_][a-zA-Z0-9_]*
+class MetricsRegistry {
+public:
+    static MetricsRegistry& Instance();
+
+    MetricCounter& GetCounter(const std::string& name);
+    MetricGauge& GetGauge(const std::string& name);
+    MetricHistogram& GetHistogram(const std::string& name);
+
+    [[nodiscard]] std::string ToJson() const;
+    [[nodiscard]] std::string ToPrometheus() const;
+
+    // Обнуляет значения, не удаляя сами метрики
+    void Reset();
+
+private:
+    MetricsRegistry() = default;
+
+    mutable std::mutex mutex_;
+    std::map<std::string, std::unique_ptr<MetricCounter>> counters_;
+    std::map<std::string, std::unique_ptr<MetricGauge>> gauges_;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> histograms_;
+};
+
+// Измеряет время жизни области видимости в наносекундах
+class ScopedMetricTimer {
+public:
+    explicit ScopedMetricTimer(MetricHistogram& histogram)
+    : histogram_(histogram), start_(std::chrono::steady_clock::now())
+    {}
+    ~ScopedMetricTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start_;
+        histogram_.Observe(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedMetricTimer(const ScopedMetricTimer&) = delete;
+    ScopedMetricTimer& operator=(const ScopedMetricTimer&) = delete;
+
+private:
+    MetricHistogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+// Макросы инструментирования. Без RGG_ENABLE_METRICS они не генерируют кода
+// и не вычисляют свои аргументы.
+#define RGG_METRICS_CONCAT_IMPL(a, b) a##b
+#define RGG_METRICS_CONCAT(a, b) RGG_METRICS_CONCAT_IMPL(a, b)
+
+#if defined(RGG_ENABLE_METRICS) && RGG_ENABLE_METRICS
+
+#define RGG_COUNTER_ADD(name, value) \
+    do { \
+        static MetricCounter& rggCounter = MetricsRegistry::Instance().GetCounter(name); \
+        rggCounter.Add(static_cast<uint64_t>(value)); \
+    } while (0)
+
+#define RGG_GAUGE_SET(name, value) \
+    do { \
+        static MetricGauge& rggGauge = MetricsRegistry::Instance().GetGauge(name); \
+        rggGauge.Set(static_cast<int64_t>(value)); \
+    } while (0)
+
+#define RGG_HISTOGRAM_OBSERVE(name, value) \
+    do { \
+        static MetricHistogram& rggHistogram = MetricsRegistry::Instance().GetHistogram(name); \
+        rggHistogram.Observe(static_cast<uint64_t>(value)); \
+    } while (0)
+
+#define RGG_SCOPED_TIMER(name) \
+    static MetricHistogram& RGG_METRICS_CONCAT(rggTimerHistogram, __LINE__) = \
+        MetricsRegistry::Instance().GetHistogram(name); \
+    ScopedMetricTimer RGG_METRICS_CONCAT(rggTimer, __LINE__)(RGG_METRICS_CONCAT(rggTimerHistogram, __LINE__))
+
+#else
+
+#define RGG_COUNTER_ADD(name, value) ((void)sizeof(value))
+#define RGG_GAUGE_SET(name, value) ((void)sizeof(value))
+#define RGG_HISTOGRAM_OBSERVE(name, value) ((void)sizeof(value))
+#define RGG_SCOPED_TIMER(name) ((void)0)
+
+#endif
+
+#endif // METRICS_H
@@ -0,0 +1,140 @@
+#include "PageRank.h"
+#include "Metrics.h"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+PageRankResult Iterate(const Graph& graph, const std::vector<double>& teleport, const PageRankOptions& options) {
+    RGG_SCOPED_TIMER("pagerank_duration_ns");
+    if (options.damping < 0.0 || options.damping > 1.0)
+        throw std::invalid_argument("Damping must be in [0, 1]");
+
+    const size_t V = graph.GetVertexCount();
+    PageRankResult result;
+    if (V == 0) {
+        result.converged = true;
+        return result;
+    }
+
+    // Строки нормируются на исходящую сумму, затем матрица транспонируется:
+    // строка v содержит вероятности перехода в v от каждого предшественника
+    CsrMatrix matrix = CsrMatrix::FromGraph(graph, options.weighted);
+    std::vector<double> outSums = matrix.RowSums();
+    std::vector<bool> dangling(V);
+    for (size_t u = 0; u < V; ++u) {
+        dangling[u] = outSums[u] <= 0.0;
+        outSums[u] = dangling[u] ? 0.0 : 1.0 / outSums[u];
+    }
+    matrix.ScaleRows(outSums);
+    const CsrMatrix transition = matrix.Transposed();
+    matrix = CsrMatrix();
+
+    const double d = options.damping;
+    std::vector<double> rank = teleport;
+    std::vector<double> next(V);
+    while (result.iterations < options.maxIterations) {
+        double danglingMass = 0.0;
+        for (size_t u = 0; u < V; ++u) {
+            if (dangling[u]) danglingMass += rank[u];
+        }
+
+        transition.Multiply(rank, next, options.threads);
+
+        const double jump = d * danglingMass + (1.0 - d);
+        double residual = 0.0;
+        for (size_t v = 0; v < V; ++v) {
+            next[v] = d * next[v] + jump * teleport[v];
+            residual += std::abs(next[v] - rank[v]);
+        }
+        rank.swap(next);
+        result.iterations++;
+        result.residual = residual;
+        if (residual < options.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+
+    RGG_COUNTER_ADD("pagerank_iterations_total", result.iterations);
+    result.scores = std::move(rank);
+    return result;
+}
+
+} // namespace
+
+PageRankResult PageRank::Compute(const Graph& graph, const PageRankOptions& options) {
+    const size_t V = graph.GetVertexCount();
+    return Iterate(graph, std::vector<double>(V, V ? 1.0 / static_cast<double>(V) : 0.0), options);
+}
+
+PageRankResult PageRank::ComputePersonalized(
+    const Graph& graph, const std::vector<double>& personalization, const PageRankOptions& options
+) {
+    if (personalization.size() != graph.GetVertexCount())
+        throw std::invalid_argument("Personalization vector size mismatch");
+
+    double sum = 0.0;
+    for (double p : personalization) {
+        if (p < 0.0 || !std::isfinite(p))
+            throw std::invalid_argument("Personalization weights must be non-negative");
+        sum += p;
+    }
+    if (sum <= 0.0 && !personalization.empty())
+        throw std::invalid_argument("Personalization vector must have positive sum");
+
+    std::vector<double> teleport(personalization);
+    for (double& p : teleport) {
+        p /= sum;
+    }
+    return Iterate(graph, teleport, options);
+}
+
+PowerIterationResult PageRank::PowerIteration(const CsrMatrix& matrix, const PageRankOptions& options) {
+    RGG_SCOPED_TIMER("power_iteration_duration_ns");
+    if (matrix.Rows() != matrix.Cols())
+        throw std::invalid_argument("Power iteration requires a square matrix");
+
+    const size_t n = matrix.Rows();
+    PowerIterationResult result;
+    if (n == 0) {
+        result.converged = true;
+        return result;
+    }
+
+    std::vector<double> x(n, 1.0 / std::sqrt(static_cast<double>(n)));
+    std::vector<double> y(n);
+    while (result.iterations < options.maxIterations) {
+        matrix.Multiply(x, y, options.threads);
+
+        // Отношение Рэлея для A при единичном x, затем сдвиг y = (A + I) x
+        double rayleigh = 0.0;
+        double norm = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            rayleigh += x[i] * y[i];
+            y[i] += x[i];
+            norm += y[i] * y[i];
+        }
+        result.eigenvalue = rayleigh;
+        norm = std::sqrt(norm);
+        if (norm == 0.0) break;
+
+        double residual = 0.0;
+        for (size_t i = 0; i < n; ++i) {
+            y[i] /= norm;
+            residual += (y[i] - x[i]) * (y[i] - x[i]);
+        }
+        x.swap(y);
+        result.iterations++;
+        result.residual = std::sqrt(residual);
+        if (result.residual < options.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+
+    RGG_COUNTER_ADD("power_iteration_iterations_total", result.iterations);
+    result.vector = std::move(x);
+    return result;
+}
@@ -0,0 +1,57 @@
+#ifndef PAGE_RANK_H
+#define PAGE_RANK_H
+
+#include "Graph.h"
+#include "SparseMatrix.h"
+#include <vector>
+
+struct PageRankOptions {
+    double damping = 0.85;
+    // Остановка, когда L1-норма изменения вектора меньше tolerance
+    double tolerance = 1e-9;
+    size_t maxIterations = 100;
+    // Переход по ребру пропорционален его весу; иначе все рёбра равновероятны
+    bool weighted = false;
+    // Число потоков умножения; 0 - по числу ядер. На результат не влияет.
+    size_t threads = 0;
+};
+
+struct PageRankResult {
+    std::vector<double> scores;
+    size_t iterations = 0;
+    double residual = 0.0;
+    bool converged = false;
+};
+
+struct PowerIterationResult {
+    // Собственный вектор с единичной L2-нормой
+    std::vector<double> vector;
+    double eigenvalue = 0.0;
+    size_t iterations = 0;
+    double residual = 0.0;
+    bool converged = false;
+};
+
+// Итеративные спектральные методы над разреженной матрицей графа.
+// Матрица переходов строится один раз в транспонированном виде, и каждая итерация -
+// это «pull»: вершина собирает вклад предшественников, потоки пишут только в свои строки.
+class PageRank {
+public:
+    // PageRank с равномерным вектором телепортации. Масса висячих вершин
+    // (без исходящих рёбер) распределяется по вектору телепортации; сумма оценок равна 1.
+    static PageRankResult Compute(const Graph& graph, const PageRankOptions& options = {});
+
+    // Персонализированный PageRank: телепортация по вектору personalization
+    // (неотрицательный, нормируется до суммы 1)
+    static PageRankResult ComputePersonalized(
+        const Graph& graph, const std::vector<double>& personalization, const PageRankOptions& options = {}
+    );
+
+    // Степенной метод для доминирующего собственного вектора квадратной матрицы
+    // с неотрицательными элементами. Итерируется A + I: собственные векторы те же,
+    // но исключаются колебания на двудольных графах. Используются tolerance,
+    // maxIterations и threads из options.
+    static PowerIterationResult PowerIteration(const CsrMatrix& matrix, const PageRankOptions& options = {});
+};
+
+#endif // PAGE_RANK_H
@@ -15,5 +15,6 @@
 #define IDC_CHECK_WEIGHTED   1006
 #define IDC_BUTTON_OK        1007
 #define IDC_BUTTON_CANCEL    1008
+#define IDC_EDIT_SEED        1009
 
 #endif // RESOURCE_H
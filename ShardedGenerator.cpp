@@ -0,0 +1,295 @@
+#include "ShardedGenerator.h"
+#include "BatchRandom.h"
+#include "GraphIO.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr uint32_t kPartitionMagic = 0x53475252; // "RRGS"
+constexpr uint16_t kPartitionVersion = 1;
+constexpr char kManifestFormat[] = "rgg-shard-1";
+
+constexpr uint16_t kFlagDirected = 1 << 0;
+constexpr uint16_t kFlagWeighted = 1 << 1;
+
+std::string ShardBaseName(const std::string& prefix, size_t shard) {
+    return prefix + ".shard" + std::to_string(shard);
+}
+
+using Manifest = std::map<std::string, std::string>;
+
+Manifest ReadManifest(const fs::path& path) {
+    std::ifstream in(path);
+    if (!in)
+        throw std::runtime_error("Cannot open shard manifest " + path.string());
+    Manifest manifest;
+    std::string line;
+    while (std::getline(in, line)) {
+        const auto eq = line.find('=');
+        if (eq == std::string::npos) continue;
+        manifest[line.substr(0, eq)] = line.substr(eq + 1);
+    }
+    if (manifest["format"] != kManifestFormat)
+        throw std::runtime_error("Unsupported shard manifest " + path.string());
+    return manifest;
+}
+
+uint64_t ManifestNumber(Manifest& manifest, const std::string& key) {
+    const auto it = manifest.find(key);
+    if (it == manifest.end())
+        throw std::runtime_error("Shard manifest is missing '" + key + "'");
+    return std::stoull(it->second);
+}
+
+} // namespace
+
+ShardedGenerator::ShardedGenerator(const ShardParams& params)
+: params_(params)
+{
+    if (params_.minV > params_.maxV) std::swap(params_.minV, params_.maxV);
+    if (params_.minE > params_.maxE) std::swap(params_.minE, params_.maxE);
+
+    // Размеры графа выбираются из глобального потока - одинаково во всех процессах
+    BatchRandom rng(params_.seed);
+    vertexCount_ = static_cast<size_t>(rng.NextInRange(params_.minV, params_.maxV));
+    if (vertexCount_ > UINT32_MAX)
+        throw std::length_error("Vertex count exceeds sampling range");
+    edgeCount_ = vertexCount_ < 2 ? 0
+        : static_cast<size_t>(rng.NextInRange(params_.minE, params_.maxE));
+    chunkCount_ = (vertexCount_ + kChunkSize - 1) / kChunkSize;
+}
+
+std::pair<size_t, size_t> ShardedGenerator::GetChunkRange(size_t chunk) const {
+    const size_t begin = chunk * kChunkSize;
+    return {begin, std::min(begin + kChunkSize, vertexCount_)};
+}
+
+size_t ShardedGenerator::GetChunkEdgeCount(size_t chunk) const {
+    if (edgeCount_ == 0) return 0;
+    // Рёбра до вершины x: floor(E * x / V) без переполнения (r * x < V^2 <= 2^64)
+    const uint64_t q = edgeCount_ / vertexCount_;
+    const uint64_t r = edgeCount_ % vertexCount_;
+    const auto edgesBefore = [&](uint64_t x) { return q * x + r * x / vertexCount_; };
+    const auto [begin, end] = GetChunkRange(chunk);
+    return static_cast<size_t>(edgesBefore(end) - edgesBefore(begin));
+}
+
+std::pair<size_t, size_t> ShardedGenerator::GetShardRange(size_t shard, size_t shardCount) const {
+    if (shardCount == 0 || shard >= shardCount)
+        throw std::out_of_range("Shard index out of range");
+    const size_t firstChunk = chunkCount_ * shard / shardCount;
+    const size_t lastChunk = chunkCount_ * (shard + 1) / shardCount;
+    return {std::min(firstChunk * kChunkSize, vertexCount_), std::min(lastChunk * kChunkSize, vertexCount_)};
+}
+
+void ShardedGenerator::GenerateChunk(size_t chunk, std::vector<int>& weights, std::vector<Edge>& edges) const {
+    const auto [begin, end] = GetChunkRange(chunk);
+    const auto chunkSize = static_cast<uint32_t>(end - begin);
+    const auto range = static_cast<uint32_t>(vertexCount_);
+
+    BatchRandom rng(BatchRandom::StreamSeed(params_.seed, chunk));
+
+    weights.assign(chunkSize, 1);
+    if (params_.weighted) {
+        rng.FillRange(weights.data(), weights.size(), params_.minWeight, params_.maxWeight);
+    }
+
+    const size_t count = GetChunkEdgeCount(chunk);
+    edges.resize(count);
+
+    constexpr size_t kBlock = BatchRandom::kBlockSize;
+    std::vector<uint32_t> fromBlock(kBlock), toBlock(kBlock);
+    std::vector<int> weightBlock(kBlock, 1);
+    for (size_t start = 0; start < count; start += kBlock) {
+        const size_t n = std::min(kBlock, count - start);
+        rng.FillBounded(fromBlock.data(), n, chunkSize);
+        rng.FillBounded(toBlock.data(), n, range);
+        if (params_.weighted) {
+            rng.FillRange(weightBlock.data(), n, params_.minWeight, params_.maxWeight);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const auto from = static_cast<uint32_t>(begin + fromBlock[i]);
+            uint32_t to = toBlock[i];
+            // Петли сдвигаем так же, как GenerateRandom
+            if (from == to) {
+                to = static_cast<uint32_t>((to + 1) % vertexCount_);
+            }
+            edges[start + i] = {from, to, weightBlock[i]};
+        }
+    }
+}
+
+void ShardedGenerator::GenerateAll(Graph& graph) const {
+    RGG_SCOPED_TIMER("sharded_generate_all_duration_ns");
+    graph.SetVertexCount(vertexCount_);
+    graph.SetWeighted(params_.weighted);
+
+    std::vector<int> vertexWeights(vertexCount_, 1);
+    std::vector<int> weights;
+    std::vector<Edge> edges;
+    for (size_t chunk = 0; chunk < chunkCount_; ++chunk) {
+        GenerateChunk(chunk, weights, edges);
+        std::copy(weights.begin(), weights.end(), vertexWeights.begin() + chunk * kChunkSize);
+        for (const auto& e : edges) {
+            graph.AddEdge(e.from, e.to, e.weight);
+        }
+    }
+    graph.SetVertexWeights(vertexWeights);
+}
+
+// Раздел: заголовок, затем для каждого блока шарда [число рёбер][веса вершин][рёбра]
+void ShardedGenerator::WriteShard(size_t shard, size_t shardCount, const std::string& prefix) const {
+    RGG_SCOPED_TIMER("sharded_write_shard_duration_ns");
+    const auto [vertexBegin, vertexEnd] = GetShardRange(shard, shardCount);
+    const size_t firstChunk = vertexBegin / kChunkSize;
+    const size_t lastChunk = (vertexEnd + kChunkSize - 1) / kChunkSize;
+
+    const std::string base = ShardBaseName(prefix, shard);
+    const fs::path partitionPath = base + ".bin";
+    const fs::path manifestPath = base + ".manifest";
+
+    // Устаревший манифест удаляем заранее: шард без манифеста считается незаписанным
+    std::error_code ec;
+    fs::remove(manifestPath, ec);
+    // Каталог префикса создаём сами, чтобы параллельные процессы не зависели от подготовки
+    if (partitionPath.has_parent_path()) {
+        fs::create_directories(partitionPath.parent_path(), ec);
+    }
+
+    std::ofstream out(partitionPath, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("Cannot create shard partition " + partitionPath.string());
+
+    uint64_t hash = HashBytes(nullptr, 0);
+    const auto flush = [&](std::string& buffer) {
+        hash = HashBytes(buffer.data(), buffer.size(), hash);
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    };
+
+    std::string buffer;
+    uint16_t flags = 0;
+    if (params_.directed) flags |= kFlagDirected;
+    if (params_.weighted) flags |= kFlagWeighted;
+    AppendBinary<uint32_t>(buffer, kPartitionMagic);
+    AppendBinary<uint16_t>(buffer, kPartitionVersion);
+    AppendBinary<uint16_t>(buffer, flags);
+    AppendBinary<uint64_t>(buffer, vertexBegin);
+    AppendBinary<uint64_t>(buffer, vertexEnd);
+    flush(buffer);
+
+    uint64_t writtenEdges = 0;
+    std::vector<int> weights;
+    std::vector<Edge> edges;
+    for (size_t chunk = firstChunk; chunk < lastChunk; ++chunk) {
+        GenerateChunk(chunk, weights, edges);
+        AppendBinary<uint64_t>(buffer, edges.size());
+        for (int w : weights) {
+            AppendBinary<int32_t>(buffer, w);
+        }
+        for (const auto& e : edges) {
+            AppendBinary<uint32_t>(buffer, e.from);
+            AppendBinary<uint32_t>(buffer, e.to);
+            AppendBinary<int32_t>(buffer, e.weight);
+        }
+        flush(buffer);
+        writtenEdges += edges.size();
+    }
+
+    out.close();
+    if (!out)
+        throw std::runtime_error("Failed to write shard partition " + partitionPath.string());
+
+    std::ofstream manifest(manifestPath, std::ios::trunc);
+    manifest << "format=" << kManifestFormat << '\n'
+             << "directed=" << (params_.directed ? 1 : 0) << '\n'
+             << "weighted=" << (params_.weighted ? 1 : 0) << '\n'
+             << "seed=" << params_.seed << '\n'
+             << "vertices=" << vertexCount_ << '\n'
+             << "edges_total=" << edgeCount_ << '\n'
+             << "shard=" << shard << '\n'
+             << "shards=" << shardCount << '\n'
+             << "vertex_begin=" << vertexBegin << '\n'
+             << "vertex_end=" << vertexEnd << '\n'
+             << "partition=" << partitionPath.filename().string() << '\n'
+             << "partition_edges=" << writtenEdges << '\n'
+             << "partition_hash=" << hash << '\n';
+    manifest.close();
+    if (!manifest)
+        throw std::runtime_error("Failed to write shard manifest " + manifestPath.string());
+}
+
+void ShardedGenerator::LoadShards(const std::string& prefix, Graph& graph, bool directed) {
+    RGG_SCOPED_TIMER("sharded_load_duration_ns");
+    Manifest first = ReadManifest(ShardBaseName(prefix, 0) + ".manifest");
+    const uint64_t shardCount = ManifestNumber(first, "shards");
+    const uint64_t vertexCount = ManifestNumber(first, "vertices");
+    if (ManifestNumber(first, "directed") != (directed ? 1u : 0u))
+        throw std::runtime_error("Graph directedness mismatch");
+    const bool weighted = ManifestNumber(first, "weighted") != 0;
+
+    graph.SetVertexCount(static_cast<size_t>(vertexCount));
+    graph.SetWeighted(weighted);
+    std::vector<int> vertexWeights(static_cast<size_t>(vertexCount), 1);
+
+    // Шарды применяются по порядку - это сохраняет порядок перезаписи повторных рёбер
+    uint64_t expectedBegin = 0;
+    for (uint64_t shard = 0; shard < shardCount; ++shard) {
+        const fs::path manifestPath = ShardBaseName(prefix, shard) + ".manifest";
+        Manifest manifest = ReadManifest(manifestPath);
+        for (const char* key : {"directed", "weighted", "seed", "vertices", "edges_total", "shards"}) {
+            if (manifest[key] != first[key])
+                throw std::runtime_error("Shard " + std::to_string(shard) + " belongs to a different graph");
+        }
+        if (ManifestNumber(manifest, "shard") != shard || ManifestNumber(manifest, "vertex_begin") != expectedBegin)
+            throw std::runtime_error("Shard " + std::to_string(shard) + " has unexpected vertex range");
+        const uint64_t vertexEnd = ManifestNumber(manifest, "vertex_end");
+        if (vertexEnd < expectedBegin || vertexEnd > vertexCount)
+            throw std::runtime_error("Shard " + std::to_string(shard) + " has unexpected vertex range");
+
+        const fs::path partitionPath = manifestPath.parent_path() / manifest["partition"];
+        std::ifstream in(partitionPath, std::ios::binary);
+        if (!in)
+            throw std::runtime_error("Cannot open shard partition " + partitionPath.string());
+        const std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        if (std::to_string(HashBytes(data.data(), data.size())) != manifest["partition_hash"])
+            throw std::runtime_error("Shard partition " + partitionPath.string() + " is corrupted");
+
+        BinaryReader reader(data);
+        if (reader.Get<uint32_t>() != kPartitionMagic || reader.Get<uint16_t>() != kPartitionVersion)
+            throw std::runtime_error("Unsupported shard partition " + partitionPath.string());
+        reader.Get<uint16_t>();
+        if (reader.Get<uint64_t>() != expectedBegin || reader.Get<uint64_t>() != vertexEnd)
+            throw std::runtime_error("Shard partition " + partitionPath.string() + " does not match manifest");
+
+        for (uint64_t v = expectedBegin; v < vertexEnd; v += kChunkSize) {
+            const uint64_t chunkEnd = std::min<uint64_t>(v + kChunkSize, vertexEnd);
+            const auto edgeCount = reader.Get<uint64_t>();
+            for (uint64_t u = v; u < chunkEnd; ++u) {
+                vertexWeights[u] = reader.Get<int32_t>();
+            }
+            for (uint64_t i = 0; i < edgeCount; ++i) {
+                const auto from = reader.Get<uint32_t>();
+                const auto to = reader.Get<uint32_t>();
+                const int w = reader.Get<int32_t>();
+                graph.AddEdge(from, to, w);
+            }
+        }
+        if (reader.Remaining() != 0)
+            throw std::runtime_error("Shard partition " + partitionPath.string() + " has trailing data");
+        expectedBegin = vertexEnd;
+    }
+
+    if (expectedBegin != vertexCount)
+        throw std::runtime_error("Shards do not cover all vertices");
+    graph.SetVertexWeights(vertexWeights);
+}
@@ -0,0 +1,74 @@
+#ifndef SHARDED_GENERATOR_H
+#define SHARDED_GENERATOR_H
+
+#include "Graph.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+// Параметры распределённой генерации (аналог аргументов GenerateRandom)
+struct ShardParams {
+    bool directed = true;
+    size_t minV = 0, maxV = 0;
+    size_t minE = 0, maxE = 0;
+    int minWeight = 1, maxWeight = 1;
+    bool weighted = true;
+    uint64_t seed = 0;
+};
+
+// Генерация графа по частям в нескольких процессах.
+//
+// Вершины разбиты на блоки фиксированного размера kChunkSize, не зависящего от числа шардов.
+// Число рёбер каждого блока пропорционально его размеру, а рёбра блока (с началом в его
+// вершинах) и веса его вершин генерируются собственным потоком случайных чисел,
+// полученным из глобального seed и номера блока. Поэтому любой процесс может независимо
+// получить свои блоки, а объединение шардов совпадает с генерацией в одном процессе
+// (GenerateAll) при том же seed.
+//
+// Как и в GenerateRandom для направленного графа, повторное ребро перезаписывает
+// вес предыдущего; для ненаправленного графа повторы схлопываются при загрузке,
+// поэтому итоговое число рёбер может быть меньше запрошенного.
+//
+// Шард i записывает файлы <prefix>.shard<i>.bin (рёбра и веса своих вершин)
+// и <prefix>.shard<i>.manifest (текстовое описание). Манифест пишется последним,
+// его наличие означает, что шард записан полностью.
+class ShardedGenerator {
+public:
+    static constexpr size_t kChunkSize = 4096;
+
+    explicit ShardedGenerator(const ShardParams& params);
+
+    [[nodiscard]] size_t GetVertexCount() const { return vertexCount_; }
+    [[nodiscard]] size_t GetEdgeCount() const { return edgeCount_; }
+    [[nodiscard]] size_t GetChunkCount() const { return chunkCount_; }
+
+    // Диапазон вершин [begin, end) шарда shard из shardCount, выровненный по блокам
+    [[nodiscard]] std::pair<size_t, size_t> GetShardRange(size_t shard, size_t shardCount) const;
+
+    // Генерирует шард и записывает его раздел и манифест; каталог prefix создаётся при необходимости
+    void WriteShard(size_t shard, size_t shardCount, const std::string& prefix) const;
+
+    // Генерация всего графа в одном процессе
+    void GenerateAll(Graph& graph) const;
+
+    // Собирает граф из всех шардов с данным префиксом, проверяя их согласованность
+    static void LoadShards(const std::string& prefix, Graph& graph, bool directed);
+
+private:
+    struct Edge {
+        uint32_t from;
+        uint32_t to;
+        int weight;
+    };
+
+    ShardParams params_;
+    size_t vertexCount_ = 0;
+    size_t edgeCount_ = 0;
+    size_t chunkCount_ = 0;
+
+    [[nodiscard]] std::pair<size_t, size_t> GetChunkRange(size_t chunk) const;
+    [[nodiscard]] size_t GetChunkEdgeCount(size_t chunk) const;
+    void GenerateChunk(size_t chunk, std::vector<int>& weights, std::vector<Edge>& edges) const;
+};
+
+#endif // SHARDED_GENERATOR_H
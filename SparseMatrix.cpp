@@ -0,0 +1,142 @@
+#include "SparseMatrix.h"
+#include "Metrics.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace {
+
+// Меньше этого числа ненулевых элементов накладные расходы на потоки не окупаются
+constexpr size_t kMinNonZerosPerThread = 1 << 15;
+
+} // namespace
+
+CsrMatrix CsrMatrix::FromGraph(const Graph& graph, bool weighted) {
+    const size_t V = graph.GetVertexCount();
+    if (V > UINT32_MAX)
+        throw std::length_error("Vertex count exceeds sparse matrix index range");
+
+    CsrMatrix m;
+    m.cols_ = V;
+    m.rowOffsets_.assign(V + 1, 0);
+    for (size_t u = 0; u < V; ++u) {
+        m.rowOffsets_[u + 1] = m.rowOffsets_[u] + graph[u].size();
+    }
+    m.columns_.resize(m.rowOffsets_[V]);
+    m.values_.resize(m.rowOffsets_[V]);
+
+    std::vector<std::pair<uint32_t, int>> row;
+    for (size_t u = 0; u < V; ++u) {
+        // Порядок в unordered_map случаен - сортируем для локальности доступа к x
+        row.assign(graph[u].begin(), graph[u].end());
+        std::sort(row.begin(), row.end());
+        size_t k = m.rowOffsets_[u];
+        for (const auto& [to, w] : row) {
+            m.columns_[k] = to;
+            m.values_[k] = weighted ? static_cast<double>(w) : 1.0;
+            ++k;
+        }
+    }
+    return m;
+}
+
+CsrMatrix CsrMatrix::Transposed() const {
+    // Сортировка подсчётом по столбцам; строки обходятся по порядку,
+    // поэтому столбцы результата тоже упорядочены
+    CsrMatrix t;
+    t.cols_ = Rows();
+    t.rowOffsets_.assign(cols_ + 1, 0);
+    for (uint32_t c : columns_) {
+        t.rowOffsets_[c + 1]++;
+    }
+    for (size_t i = 0; i < cols_; ++i) {
+        t.rowOffsets_[i + 1] += t.rowOffsets_[i];
+    }
+
+    t.columns_.resize(NonZeros());
+    t.values_.resize(NonZeros());
+    std::vector<size_t> next(t.rowOffsets_.begin(), t.rowOffsets_.end() - 1);
+    for (size_t r = 0; r < Rows(); ++r) {
+        for (size_t k = rowOffsets_[r]; k < rowOffsets_[r + 1]; ++k) {
+            const size_t pos = next[columns_[k]]++;
+            t.columns_[pos] = static_cast<uint32_t>(r);
+            t.values_[pos] = values_[k];
+        }
+    }
+    return t;
+}
+
+std::vector<double> CsrMatrix::RowSums() const {
+    std::vector<double> sums(Rows(), 0.0);
+    for (size_t r = 0; r < Rows(); ++r) {
+        for (size_t k = rowOffsets_[r]; k < rowOffsets_[r + 1]; ++k) {
+            sums[r] += values_[k];
+        }
+    }
+    return sums;
+}
+
+void CsrMatrix::ScaleRows(const std::vector<double>& scale) {
+    if (scale.size() != Rows())
+        throw std::invalid_argument("Scale vector size mismatch");
+    for (size_t r = 0; r < Rows(); ++r) {
+        for (size_t k = rowOffsets_[r]; k < rowOffsets_[r + 1]; ++k) {
+            values_[k] *= scale[r];
+        }
+    }
+}
+
+void CsrMatrix::MultiplyRows(const double* x, double* y, size_t firstRow, size_t lastRow) const {
+    const size_t* offsets = rowOffsets_.data();
+    const uint32_t* cols = columns_.data();
+    const double* vals = values_.data();
+    for (size_t r = firstRow; r < lastRow; ++r) {
+        // Два независимых аккумулятора сокращают цепочку зависимостей по сложению
+        double sum0 = 0.0, sum1 = 0.0;
+        size_t k = offsets[r];
+        const size_t end = offsets[r + 1];
+        for (; k + 1 < end; k += 2) {
+            sum0 += vals[k] * x[cols[k]];
+            sum1 += vals[k + 1] * x[cols[k + 1]];
+        }
+        if (k < end) {
+            sum0 += vals[k] * x[cols[k]];
+        }
+        y[r] = sum0 + sum1;
+    }
+}
+
+void CsrMatrix::Multiply(const std::vector<double>& x, std::vector<double>& y, size_t threads) const {
+    RGG_SCOPED_TIMER("spmv_multiply_duration_ns");
+    if (x.size() != cols_)
+        throw std::invalid_argument("Vector size mismatch");
+    y.resize(Rows());
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = std::min(threads, std::max<size_t>(1, NonZeros() / kMinNonZerosPerThread));
+    if (threads <= 1 || Rows() < threads) {
+        MultiplyRows(x.data(), y.data(), 0, Rows());
+        return;
+    }
+
+    // Границы диапазонов строк с примерно равным числом ненулевых элементов
+    std::vector<size_t> bounds(threads + 1, Rows());
+    bounds[0] = 0;
+    for (size_t t = 1; t < threads; ++t) {
+        const size_t target = NonZeros() * t / threads;
+        const auto it = std::lower_bound(rowOffsets_.begin(), rowOffsets_.end(), target);
+        bounds[t] = std::max(bounds[t - 1], static_cast<size_t>(it - rowOffsets_.begin()));
+        bounds[t] = std::min(bounds[t], Rows());
+    }
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (size_t t = 1; t < threads; ++t) {
+        workers.emplace_back(&CsrMatrix::MultiplyRows, this, x.data(), y.data(), bounds[t], bounds[t + 1]);
+    }
+    MultiplyRows(x.data(), y.data(), bounds[0], bounds[1]);
+    for (auto& w : workers) {
+        w.join();
+    }
+}
@@ -0,0 +1,47 @@
+#ifndef SPARSE_MATRIX_H
+#define SPARSE_MATRIX_H
+
+#include "Graph.h"
+#include <vector>
+
+// Разреженная матрица в формате CSR (сжатые строки).
+// Для графа строка u содержит рёбра u -> v: столбец v и вес ребра.
+// Транспонированная матрица (Transposed) - это CSC-представление исходной,
+// её строки содержат входящие рёбра и используются для «pull»-итераций.
+// Внутри строки столбцы упорядочены по возрастанию.
+class CsrMatrix {
+public:
+    CsrMatrix() = default;
+
+    // Матрица смежности графа; без weighted все ненулевые элементы равны 1
+    static CsrMatrix FromGraph(const Graph& graph, bool weighted);
+
+    [[nodiscard]] CsrMatrix Transposed() const;
+
+    // Сумма элементов каждой строки
+    [[nodiscard]] std::vector<double> RowSums() const;
+    // Умножает строку i на scale[i]
+    void ScaleRows(const std::vector<double>& scale);
+
+    // y = A * x. Строки делятся между потоками поровну по числу ненулевых элементов;
+    // threads = 0 - по числу ядер, маленькие матрицы считаются в одном потоке.
+    void Multiply(const std::vector<double>& x, std::vector<double>& y, size_t threads = 0) const;
+
+    [[nodiscard]] size_t Rows() const { return rowOffsets_.empty() ? 0 : rowOffsets_.size() - 1; }
+    [[nodiscard]] size_t Cols() const { return cols_; }
+    [[nodiscard]] size_t NonZeros() const { return columns_.size(); }
+
+    [[nodiscard]] const std::vector<size_t>& RowOffsets() const { return rowOffsets_; }
+    [[nodiscard]] const std::vector<uint32_t>& Columns() const { return columns_; }
+    [[nodiscard]] const std::vector<double>& Values() const { return values_; }
+
+private:
+    size_t cols_ = 0;
+    std::vector<size_t> rowOffsets_;
+    std::vector<uint32_t> columns_;
+    std::vector<double> values_;
+
+    void MultiplyRows(const double* x, double* y, size_t firstRow, size_t lastRow) const;
+};
+
+#endif // SPARSE_MATRIX_H
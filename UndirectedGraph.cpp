@@ -1,6 +1,8 @@
 #include "UndirectedGraph.h"
+#include "Metrics.h"
 #include <stdexcept>
-#include <random>
+#include "BatchRandom.h"
+#include <algorithm>
 
 UndirectedGraph::UndirectedGraph(bool weighted)
 : weighted_(weighted)
@@ -16,6 +18,66 @@ size_t UndirectedGraph::GetVertexCount() const {
     return adjacency_.size();
 }
 
+void UndirectedGraph::AddVertices(size_t count) {
+    const size_t newCount = GetVertexCount() + count;
+    adjacency_.resize(newCount);
+    vertexWeights_.resize(newCount, 1);
+}
+
+void UndirectedGraph::Resize(size_t count) {
+    const size_t V = GetVertexCount();
+    if (count >= V) {
+        AddVertices(count - V);
+        return;
+    }
+
+    // Списки смежности симметричны - удаляем обратные рёбра отбрасываемых вершин
+    for (size_t u = count; u < V; ++u) {
+        for (const auto& [to, w] : adjacency_[u]) {
+            if (to < count) adjacency_[to].erase(u);
+        }
+    }
+    adjacency_.resize(count);
+    vertexWeights_.resize(count);
+}
+
+void UndirectedGraph::ClearEdges() {
+    for (auto& edges : adjacency_) {
+        edges.clear();
+    }
+}
+
+void UndirectedGraph::RemoveVertex(size_t v) {
+    const size_t V = GetVertexCount();
+    if (v >= V)
+        throw std::out_of_range("Vertex index out of range");
+    const size_t last = V - 1;
+
+    for (const auto& [to, w] : adjacency_[v]) {
+        if (to != v) adjacency_[to].erase(v);
+    }
+    adjacency_[v].clear();
+
+    // Переименовываем last -> v у соседей последней вершины
+    if (v != last) {
+        std::unordered_map<size_t,int> edges;
+        for (const auto& [to, w] : adjacency_[last]) {
+            if (to == last) {
+                edges[v] = w;
+                continue;
+            }
+            edges[to] = w;
+            adjacency_[to].erase(last);
+            adjacency_[to][v] = w;
+        }
+        adjacency_[v] = std::move(edges);
+        vertexWeights_[v] = vertexWeights_[last];
+    }
+
+    adjacency_.pop_back();
+    vertexWeights_.pop_back();
+}
+
 void UndirectedGraph::AddEdge(size_t from, size_t to, int weight) {
     if (from >= GetVertexCount() || to >= GetVertexCount())
         throw std::out_of_range("Vertex index out of range");
@@ -59,18 +121,21 @@ void UndirectedGraph::GenerateRandom(
     size_t minVertices, size_t maxVertices,
     size_t minEdges, size_t maxEdges,
     int minWeight, int maxWeight,
-    bool weighted
+    bool weighted,
+    uint32_t seed
 ) {
+    RGG_SCOPED_TIMER("undirected_generate_duration_ns");
+
     // Корректируем диапазоны
     if (minVertices > maxVertices) std::swap(minVertices, maxVertices);
     if (minEdges > maxEdges) std::swap(minEdges, maxEdges);
 
     weighted_ = weighted;
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    BatchRandom rng(seed);
 
-    std::uniform_int_distribution<size_t> distV(minVertices, maxVertices);
-    size_t vertexCount = distV(gen);
+    size_t vertexCount = static_cast<size_t>(rng.NextInRange(minVertices, maxVertices));
+    if (vertexCount > UINT32_MAX)
+        throw std::length_error("Vertex count exceeds sampling range");
 
     SetVertexCount(vertexCount);
 
@@ -79,23 +144,37 @@ void UndirectedGraph::GenerateRandom(
         return;
     }
 
-    std::uniform_int_distribution<size_t> distE(minEdges, maxEdges);
-    size_t edgeCount = distE(gen);
-
-    std::uniform_int_distribution<size_t> distVertex(0, vertexCount - 1);
-    std::uniform_int_distribution<int> distW(minWeight, maxWeight);
+    size_t edgeCount = static_cast<size_t>(rng.NextInRange(minEdges, maxEdges));
+    const auto range = static_cast<uint32_t>(vertexCount);
 
     // Генерация весов вершин
-    if (weighted_ && vertexCount > 0) {
-        for (auto &w : vertexWeights_) {
-            w = distW(gen);
-        }
+    if (weighted_) {
+        rng.FillRange(vertexWeights_.data(), vertexWeights_.size(), minWeight, maxWeight);
     }
 
+    // Кандидаты в рёбра генерируются пакетами; вес используется только у принятых
+    constexpr size_t kBlock = BatchRandom::kBlockSize;
+    std::vector<uint32_t> fromBlock(kBlock), toBlock(kBlock);
+    std::vector<int> weightBlock(kBlock, 1);
+    size_t blockPos = kBlock;
+
     size_t added = 0;
+    size_t rejected = 0;
+    size_t rehashes = 0;
     while (added < edgeCount) {
-        size_t from = distVertex(gen);
-        size_t to = distVertex(gen);
+        if (blockPos == kBlock) {
+            rng.FillBounded(fromBlock.data(), kBlock, range);
+            rng.FillBounded(toBlock.data(), kBlock, range);
+            if (weighted_) {
+                rng.FillRange(weightBlock.data(), kBlock, minWeight, maxWeight);
+            }
+            blockPos = 0;
+        }
+
+        size_t from = fromBlock[blockPos];
+        size_t to = toBlock[blockPos];
+        const int w = weightBlock[blockPos];
+        blockPos++;
         // Избегаем петель
         if (from == to && vertexCount > 1) {
             to = (to + 1) % vertexCount;
@@ -103,11 +182,19 @@ void UndirectedGraph::GenerateRandom(
 
         // Проверяем, есть ли уже ребро
         if (!HasEdge(from, to)) {
-            int w = weighted_ ? distW(gen) : 1;
+            const size_t bucketsBefore = adjacency_[from].bucket_count() + adjacency_[to].bucket_count();
             AddEdge(from, to, w);
+            if (adjacency_[from].bucket_count() + adjacency_[to].bucket_count() != bucketsBefore) rehashes++;
             added++;
+        } else {
+            rejected++;
         }
     }
+
+    RGG_COUNTER_ADD("undirected_generate_edge_samples_total", added + rejected);
+    RGG_COUNTER_ADD("undirected_generate_rejected_samples_total", rejected);
+    RGG_COUNTER_ADD("undirected_generate_rehashes_total", rehashes);
+    RGG_GAUGE_SET("undirected_graph_memory_bytes", GetMemoryUsage());
 }
 
 void UndirectedGraph::SetVertexWeights(const std::vector<int>& weights) {
@@ -118,4 +205,16 @@ void UndirectedGraph::SetVertexWeights(const std::vector<int>& weights) {
 int UndirectedGraph::GetVertexWeight(size_t v) const {
     if (v >= GetVertexCount()) throw std::out_of_range("Vertex index out of range");
     return vertexWeights_[v];
+}
+
+size_t UndirectedGraph::GetMemoryUsage() const {
+    // Узел unordered_map: указатель на следующий узел, пара ключ-значение и кэшированный хэш
+    constexpr size_t nodeSize = sizeof(void*) + sizeof(std::pair<const size_t,int>) + sizeof(size_t);
+    size_t bytes = sizeof(*this)
+        + adjacency_.capacity() * sizeof(adjacency_[0])
+        + vertexWeights_.capacity() * sizeof(int);
+    for (const auto& edges : adjacency_) {
+        bytes += edges.bucket_count() * sizeof(void*) + edges.size() * nodeSize;
+    }
+    return bytes;
 }
\ No newline at end of file
@@ -11,6 +11,11 @@ public:
     void SetVertexCount(size_t count) override;
     size_t GetVertexCount() const override;
 
+    void AddVertices(size_t count) override;
+    void Resize(size_t count) override;
+    void RemoveVertex(size_t v) override;
+    void ClearEdges() override;
+
     void AddEdge(size_t from, size_t to, int weight = 1) override;
     void RemoveEdge(size_t from, size_t to) override;
     bool HasEdge(size_t from, size_t to) const override;
@@ -24,12 +29,17 @@ public:
         size_t minVertices, size_t maxVertices,
         size_t minEdges, size_t maxEdges,
         int minWeight, int maxWeight,
-        bool weighted
+        bool weighted,
+        uint32_t seed
     ) override;
+    using Graph::GenerateRandom;
 
     void SetVertexWeights(const std::vector<int>& weights) override;
     int GetVertexWeight(size_t v) const override;
     bool IsWeighted() const override { return weighted_; }
+    void SetWeighted(bool weighted) override { weighted_ = weighted; }
+
+    size_t GetMemoryUsage() const override;
 
 private:
     std::vector<std::unordered_map<size_t,int>> adjacency_;
@@ -5,6 +5,8 @@
 #include "DirectedGraph.h"
 #include "UndirectedGraph.h"
 #include "GraphVisualizer.h"
+#include "GraphCache.h"
+#include "GraphQuery.h"
 #include "Resource.h"
 
 LRESULT CALLBACK WndProc(HWND, UINT, WPARAM, LPARAM);
@@ -15,30 +17,57 @@ static UndirectedGraph g_undirectedGraph(true);
 static Graph* g_currentGraph = &g_directedGraph;
 static std::unique_ptr<GraphVisualizer> g_visualizer; // используем умный указатель вместо raw
 
+// Окрестность выбранной вершины (правый клик) и буферы для её выборки
+static DirectedGraph g_focusDirectedGraph(true);
+static UndirectedGraph g_focusUndirectedGraph(true);
+static GraphQuery g_graphQuery;
+constexpr size_t kFocusHops = 2;
+
 struct GraphParams {
     size_t minV = 5, maxV = 10;
     size_t minE = 5, maxE = 20;
     bool directed = true;
     bool weighted = true;
+    uint32_t seed = 0; // 0 - случайный граф без кэширования
 } g_params;
 
+// Графы с фиксированным seed берутся из дискового кэша
+static GraphCache g_graphCache(std::filesystem::temp_directory_path() / "RandomGraphGenerator");
+
 HINSTANCE g_hInst = nullptr;
 HWND g_hWnd = nullptr;
 
-void GenerateNewGraph(HWND hWnd) {
+void GenerateCurrentGraph() {
     // Переключаемся на нужный тип графа
     g_currentGraph = g_params.directed ?
         static_cast<Graph *>(&g_directedGraph) : static_cast<Graph *>(&g_undirectedGraph);
 
-    g_currentGraph->GenerateRandom(
-        g_params.minV, g_params.maxV,
-        g_params.minE, g_params.maxE,
-        1, 10,
-        g_params.weighted
-    );
+    if (g_params.seed == 0) {
+        g_currentGraph->GenerateRandom(
+            g_params.minV, g_params.maxV,
+            g_params.minE, g_params.maxE,
+            1, 10,
+            g_params.weighted
+        );
+        return;
+    }
+
+    GraphCacheKey key;
+    key.directed = g_params.directed;
+    key.minV = g_params.minV;
+    key.maxV = g_params.maxV;
+    key.minE = g_params.minE;
+    key.maxE = g_params.maxE;
+    key.minWeight = 1;
+    key.maxWeight = 10;
+    key.weighted = g_params.weighted;
+    key.seed = g_params.seed;
+    g_graphCache.GetOrGenerate(key, *g_currentGraph);
+}
 
+void ShowGraph(HWND hWnd, Graph& graph) {
     // Каждый раз пересоздаём GraphVisualizer
-    g_visualizer = std::make_unique<GraphVisualizer>(*g_currentGraph, g_params.directed);
+    g_visualizer = std::make_unique<GraphVisualizer>(graph, g_params.directed);
 
     RECT rc;
     GetClientRect(hWnd, &rc);
@@ -47,6 +76,31 @@ void GenerateNewGraph(HWND hWnd) {
     InvalidateRect(hWnd, nullptr, TRUE);
 }
 
+void GenerateNewGraph(HWND hWnd) {
+    GenerateCurrentGraph();
+    ShowGraph(hWnd, *g_currentGraph);
+}
+
+// Показывает k-окрестность вершины, отображаемой в точке (x, y).
+// Клик мимо вершин возвращает к полному графу.
+void FocusVertex(HWND hWnd, int x, int y) {
+    const auto hit = g_visualizer->HitTestVertex(x, y);
+    if (!hit.has_value()) {
+        ShowGraph(hWnd, *g_currentGraph);
+        return;
+    }
+
+    // Если уже показана окрестность, номер вершины нужно перевести в исходный граф
+    Graph& focusGraph = g_params.directed ?
+        static_cast<Graph &>(g_focusDirectedGraph) : static_cast<Graph &>(g_focusUndirectedGraph);
+    const auto& labels = g_visualizer->GetVertexLabels();
+    const size_t center = *hit < labels.size() ? labels[*hit] : *hit;
+
+    const auto& original = g_graphQuery.EgoNetwork(*g_currentGraph, center, kFocusHops, focusGraph);
+    ShowGraph(hWnd, focusGraph);
+    g_visualizer->SetVertexLabels(original);
+}
+
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
     g_hInst = hInstance;
     constexpr TCHAR szAppName[] = TEXT("RandomGraphApp");
@@ -78,14 +132,7 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE, LPSTR, int nCmdShow) {
     UpdateWindow(g_hWnd);
 
     // Изначально генерируем граф
-    g_currentGraph = g_params.directed ?
-        static_cast<Graph *>(&g_directedGraph) : static_cast<Graph *>(&g_undirectedGraph);
-    g_currentGraph->GenerateRandom(
-        g_params.minV, g_params.maxV,
-        g_params.minE, g_params.maxE,
-        1, 10,
-        g_params.weighted
-    );
+    GenerateCurrentGraph();
 
     g_visualizer = std::make_unique<GraphVisualizer>(*g_currentGraph, g_params.directed);
     {
@@ -109,6 +156,7 @@ INT_PTR CALLBACK ParamDlgProc(HWND hDlg, UINT message, WPARAM wParam, LPARAM lPa
         SetDlgItemInt(hDlg, IDC_EDIT_MAXV, static_cast<UINT>(g_params.maxV), FALSE);
         SetDlgItemInt(hDlg, IDC_EDIT_MINE, static_cast<UINT>(g_params.minE), FALSE);
         SetDlgItemInt(hDlg, IDC_EDIT_MAXE, static_cast<UINT>(g_params.maxE), FALSE);
+        SetDlgItemInt(hDlg, IDC_EDIT_SEED, static_cast<UINT>(g_params.seed), FALSE);
         CheckDlgButton(hDlg, IDC_CHECK_DIRECTED, g_params.directed ? BST_CHECKED : BST_UNCHECKED);
         CheckDlgButton(hDlg, IDC_CHECK_WEIGHTED, g_params.weighted ? BST_CHECKED : BST_UNCHECKED);
         return (INT_PTR)TRUE;
@@ -121,6 +169,7 @@ INT_PTR CALLBACK ParamDlgProc(HWND hDlg, UINT message, WPARAM wParam, LPARAM lPa
             g_params.maxV = GetDlgItemInt(hDlg, IDC_EDIT_MAXV, &success, FALSE);
             g_params.minE = GetDlgItemInt(hDlg, IDC_EDIT_MINE, &success, FALSE);
             g_params.maxE = GetDlgItemInt(hDlg, IDC_EDIT_MAXE, &success, FALSE);
+            g_params.seed = GetDlgItemInt(hDlg, IDC_EDIT_SEED, &success, FALSE);
             g_params.directed = (IsDlgButtonChecked(hDlg, IDC_CHECK_DIRECTED) == BST_CHECKED);
             g_params.weighted = (IsDlgButtonChecked(hDlg, IDC_CHECK_WEIGHTED) == BST_CHECKED);
 
@@ -180,6 +229,12 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         }
         return 0;
 
+    case WM_RBUTTONDOWN:
+        if (g_visualizer) {
+            FocusVertex(hWnd, GET_X_LPARAM(lParam), GET_Y_LPARAM(lParam));
+        }
+        return 0;
+
     case WM_LBUTTONUP:
         if (g_visualizer) {
             int x = GET_X_LPARAM(lParam);